@@ -73,6 +73,12 @@ else
   echo '   'Link with libmesh.......... : yes
 fi
 
+if test "$HAVE_OPENMP" = "0"; then
+  echo '   'Enable OpenMP.............. : no
+else
+  echo '   'Enable OpenMP.............. : yes
+fi
+
 if test "$HAVE_GCOV_TOOLS" = "0"; then
    echo '   'Enable gcov code coverage.. : no
 else
@@ -68,6 +68,14 @@ public:
   
   //! Logarithm of the value of the scalar function.
   virtual       double                 lnValue    (const V& domainVector, const V* domainDirection, V* gradVector, M* hessianMatrix, V* hessianEffect) const = 0;
+
+  //! Whether actualValue() and lnValue() may run concurrently in several threads (default: true).
+  bool                                 isReentrant()                const;
+
+  //! Declares whether actualValue() and lnValue() may run concurrently in several threads.
+  /*! Functions that write to shared work buffers should call setReentrant(false), so that
+   * threaded algorithms evaluate them serially. */
+  void                                 setReentrant(bool reentrant);
   //@}
 protected:
   const BaseEnvironment& m_env;
@@ -75,6 +83,9 @@ protected:
 	
   //! Domain set of the scalar function.	
   const VectorSet<V,M>&  m_domainSet;
+
+  //! Whether the function may be evaluated concurrently in several threads.
+        bool                    m_reentrant;
 };
 
 }  // End namespace QUESO
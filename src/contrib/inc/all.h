@@ -67,7 +67,11 @@
 #include<queso/InfiniteDimensionalMCMCSampler.h>
 #include<queso/asserts.h>
 #include<queso/RngBoost.h>
+#include<queso/RngPhilox.h>
 #include<queso/GslMatrix.h>
+#include<queso/BlockCyclicMatrix.h>
+#include<queso/FixedVector.h>
+#include<queso/FixedMatrix.h>
 #include<queso/MpiComm.h>
 #include<queso/Defines.h>
 #include<queso/FunctionOperatorBuilder.h>
@@ -93,6 +97,7 @@
 #include<queso/GenericMatrixCovarianceFunction.h>
 #include<queso/ExponentialScalarCovarianceFunction.h>
 #include<queso/GaussianVectorRealizer.h>
+#include<queso/TruncatedGaussianVectorRealizer.h>
 #include<queso/MatrixCovarianceFunction.h>
 #include<queso/GaussianVectorCdf.h>
 #include<queso/MonteCarloSGOptions.h>
@@ -130,6 +135,7 @@
 #include<queso/VectorMdf.h>
 #include<queso/BetaJointPdf.h>
 #include<queso/GaussianVectorRV.h>
+#include<queso/TruncatedGaussianVectorRV.h>
 #include<queso/StatisticalForwardProblem.h>
 #include<queso/MarkovChainPositionData.h>
 #include<queso/StdScalarCdf.h>
@@ -144,7 +150,9 @@
 #include<queso/LogNormalJointPdf.h>
 #include<queso/VectorRV.h>
 #include<queso/InverseGammaJointPdf.h>
+#include<queso/DiagPlusLowRankCovMatrix.h>
 #include<queso/GaussianJointPdf.h>
+#include<queso/TruncatedGaussianJointPdf.h>
 #include<queso/ExperimentModelOptions.h>
 #include<queso/SimulationModelOptions.h>
 #include<queso/ExperimentModel.h>
@@ -0,0 +1,203 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008,2009,2010,2011,2012,2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef UQ_BLOCK_CYCLIC_MATRIX_H
+#define UQ_BLOCK_CYCLIC_MATRIX_H
+
+/*! \file BlockCyclicMatrix.h
+    \brief QUESO matrix class whose rows are distributed over the processors of a sub-environment.
+*/
+
+#include <queso/Matrix.h>
+#include <queso/GslVector.h>
+#include <gsl/gsl_matrix.h>
+
+namespace QUESO {
+
+/*! \class BlockCyclicMatrix
+    \brief Class for dense matrices too large to be stored by one processor.
+
+    The rows of the matrix are split into blocks of \c blockSize consecutive rows, and the blocks
+    are dealt cyclically to the processors of the sub-environment communicator \c subComm(): block
+    \c b is stored by processor \c b \c % \c subComm().NumProc(). Each processor keeps its rows,
+    with all their columns, in a gsl_matrix. Vectors are GslVector objects, replicated on every
+    processor of the sub-environment.
+
+    The Cholesky factorization, the solves with it, the log-determinant and the matrix-vector
+    product are computed cooperatively, and every processor of the sub-environment must call them.
+    Element access is only allowed for rows stored by the calling processor (see ownsRow()).
+*/
+class BlockCyclicMatrix : public Matrix
+{
+public:
+  //! @name Constructor/Destructor methods
+  //@{
+  //! Shaped Constructor: creates a matrix with \c map.NumGlobalElements() rows and \c numCols columns, filled with zeros.
+  /*! The rows are distributed over \c env.subComm(), in blocks of \c blockSize rows. */
+  BlockCyclicMatrix(const BaseEnvironment& env,
+                    const Map&             map,
+                    unsigned int           numCols,
+                    unsigned int           blockSize = 64);
+
+  //! Shaped Constructor: \c this matrix is a copy of matrix \c B.
+  BlockCyclicMatrix(const BlockCyclicMatrix& B);
+
+  //! Destructor
+  ~BlockCyclicMatrix();
+  //@}
+
+  //! @name Set methods
+  //@{
+  //! Copies values from matrix \c rhs to \c this.
+  BlockCyclicMatrix& operator=(const BlockCyclicMatrix& rhs);
+
+  //! Stores in \c this the coordinate-wise multiplication of \c this and \c a.
+  BlockCyclicMatrix& operator*=(double a);
+  //@}
+
+  //! @name Accessor methods
+  //@{
+  //! Element access method (non-const), with the global row index \c i.
+  /*! Row \c i must be stored by the calling processor. */
+  double& operator()(unsigned int i, unsigned int j);
+
+  //! Element access method (const), with the global row index \c i.
+  /*! Row \c i must be stored by the calling processor. */
+  const double& operator()(unsigned int i, unsigned int j) const;
+
+  //! Returns whether the global row \c i is stored by the calling processor.
+  bool         ownsRow         (unsigned int i) const;
+
+  //! Returns the global index of the local row \c localRowId.
+  unsigned int globalRowId     (unsigned int localRowId) const;
+  //@}
+
+  //! @name Attribute methods
+  //@{
+  //! Returns the number of rows stored by the calling processor.
+  unsigned int numRowsLocal    () const;
+
+  //! Returns the number of rows of the whole matrix.
+  unsigned int numRowsGlobal   () const;
+
+  //! Returns the number of columns of the matrix.
+  unsigned int numCols         () const;
+
+  //! Returns the number of consecutive rows in each block.
+  unsigned int blockSize       () const;
+
+  //! Calculates the ln(determinant) of \c this symmetric positive definite matrix.
+  /*! It is twice the sum of the logarithms of the diagonal of the Cholesky factor, which is
+   * computed once and cached until \c this matrix changes. */
+  double       lnDeterminant   () const;
+  //@}
+
+  //! @name Mathematical methods
+  //@{
+  //! Computes the Cholesky factorization of \c this real symmetric positive definite matrix, in place.
+  /*! The factor L is stored in the lower triangle, and the upper triangle is set to zero.
+   * In case \c this fails to be symmetric and positive definite, an error will be returned on every
+   * processor. The factorization is right-looking, by blocks: the diagonal block is factored by
+   * the processor storing it and broadcast, each processor then solves for its rows of the panel
+   * and updates its rows of the trailing matrix with level 3 BLAS. */
+  int          chol            ();
+
+  //! This function multiplies \c this matrix by vector \c x and returns the resulting vector.
+  GslVector    multiply        (const GslVector& x) const;
+
+  //! This function calculates the inverse of \c this symmetric positive definite matrix and multiplies it with vector \c b.
+  GslVector    invertMultiply  (const GslVector& b) const;
+
+  //! This function calculates the inverse of \c this symmetric positive definite matrix, multiplies it with vector \c b and stores the result in vector \c x.
+  /*! It uses the cached Cholesky factor of \c this matrix, computing it if needed. */
+  void         invertMultiply  (const GslVector& b, GslVector& x) const;
+  //@}
+
+  //! @name Get/Set methods
+  //@{
+  //! Component-wise set all values to \c this with value.
+  void         cwSet           (double value);
+
+  //! This function sets all the entries bellow the main diagonal of \c this matrix to zero.
+  void         zeroLower       (bool includeDiagonal = false);
+
+  //! This function sets all the entries above the main diagonal of \c this matrix to zero.
+  void         zeroUpper       (bool includeDiagonal = false);
+  //@}
+
+  //! @name I/O methods
+  //@{
+  //! Print method. Each processor prints the rows it stores, preceded by their global indices.
+  void         print           (std::ostream& os) const;
+  //@}
+
+private:
+  //! Default Constructor. It should not be used.
+  BlockCyclicMatrix();
+
+  //! In this function \c this matrix receives a copy of matrix \c src.
+  void         copy            (const BlockCyclicMatrix& src);
+
+  //! This function discards the cached Cholesky factor.
+  void         resetFactorization();
+
+  //! This function computes and caches the Cholesky factor of \c this matrix.
+  void         factorizeCholesky() const;
+
+  //! This function factors the rows \c localRows, distributed like \c this matrix, in place.
+  int          distributedCholesky(gsl_matrix* localRows) const;
+
+  //! Processor storing the block of rows starting at global row \c blockBegin.
+  int          blockOwner      (unsigned int blockBegin) const;
+
+  //! Number of local rows whose global index is smaller than \c globalRow.
+  unsigned int numLocalRowsBefore(unsigned int globalRow) const;
+
+  //! Number of rows stored by processor \c pid whose global index is smaller than \c globalRow.
+  unsigned int numRowsBefore   (unsigned int globalRow, int pid) const;
+
+  //! Returns the global index of the local row \c localRowId of processor \c pid.
+  unsigned int globalRowIdOfProc(unsigned int localRowId, int pid) const;
+
+  //! Communicator the rows are distributed over.
+  const MpiComm&       m_comm;
+
+  unsigned int         m_numRowsGlobal;
+  unsigned int         m_numCols;
+  unsigned int         m_blockSize;
+
+  //! Rows stored by the calling processor, in increasing global order.
+  gsl_matrix*          m_mat;
+
+  //! Rows of the Cholesky factor stored by the calling processor.
+  mutable gsl_matrix*  m_chol;
+
+  mutable double       m_lnDeterminant;
+};
+
+std::ostream& operator<<(std::ostream& os, const BlockCyclicMatrix& obj);
+
+}  // End namespace QUESO
+
+#endif // UQ_BLOCK_CYCLIC_MATRIX_H
@@ -28,7 +28,7 @@
 #include <queso/config_queso.h>
 #include <queso/asserts.h>
 
-//! Defines available optional libraries (GLPK, HDF5, Trilinos)
+//! Defines available optional libraries (GLPK, HDF5, Trilinos, ANN, OpenMP)
 
 #ifdef QUESO_HAVE_GLPK
 #define QUESO_HAS_GLPK
@@ -46,6 +46,10 @@
 #define QUESO_HAS_ANN
 #endif
 
+#ifdef QUESO_HAVE_OPENMP
+#define QUESO_HAS_OPENMP
+#endif
+
 #define QUESO_HAS_MPI
 
 #include <iostream>
@@ -147,7 +151,7 @@ public:
   //! Checking level
   unsigned int           m_checkingLevel;
 
-  //! Type of the random number generator.
+  //! Type of the random number generator: "gsl", "boost" or "philox" (counter based, with independent streams).
   std::string            m_rngType;
   
   //! Seed of the random number generator.
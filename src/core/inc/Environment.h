@@ -240,6 +240,7 @@ public:
   const MpiComm&   inter0Comm    () const;
 
   //! Access function for m_subDisplayFile (displays file on stream).
+  /*! Inside an OpenMP parallel region, only the master thread gets the file; other threads get NULL. */
   std::ofstream*  subDisplayFile() const;
 
   //! Access function for m_subDisplayFileName (displays filename on stream).
@@ -288,11 +289,31 @@ public:
   unsigned int    checkingLevel    () const;
 
   //! Access to the RNG object.
+  /*! If the calling thread has been given its own RNG object through setThreadRngObject(), that
+   * object is returned instead. */
   const RngBase* rngObject  () const;
 
   //! Reset RNG seed.
   void                  resetSeed  (int newSeedOption);
 
+  //! Creates a new RNG object, of the same type of the main RNG object, with seed \c newSeed.
+  /*! The caller owns the returned object. */
+  RngBase*       newRngObject(int newSeed) const;
+
+  //! Creates a new RNG object, of the same type of the main RNG object, on the stream identified by the triple (worldRank(), \c threadId, \c chainId).
+  /*! Each processor gets its own stream for each pair (\c threadId, \c chainId). With rngType
+   * 'philox' the streams share the main seed and are disjoint parts of the same counter space,
+   * none of them being stream 0 of the main RNG object; the other RNG types are reseeded from a
+   * hash of the main seed and of the triple. \c threadId must be below 2^16, and both worldRank()+1
+   * and \c chainId below 2^24. The caller owns the returned object. */
+  RngBase*       newRngStreamObject(unsigned int threadId, unsigned int chainId) const;
+
+  //! Makes rngObject() return \c threadRngObject to the calling thread.
+  /*! Used to give each thread of an OpenMP parallel region its own RNG stream. Passing NULL gives
+   * the calling thread back the main RNG object. The environment does not take ownership of
+   * \c threadRngObject. */
+  void           setThreadRngObject(const RngBase* threadRngObject) const;
+
   //! Access to the RNG seed.
   int                   seed       () const;
 
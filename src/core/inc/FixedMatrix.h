@@ -0,0 +1,1648 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008,2009,2010,2011,2012,2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef UQ_FIXED_MATRIX_H
+#define UQ_FIXED_MATRIX_H
+
+/*! \file FixedMatrix.h
+    \brief Matrix class with a size fixed at compile time
+*/
+
+#include <queso/Matrix.h>
+#include <queso/FixedVector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_eigen.h>
+#include <gsl/gsl_errno.h>
+#include <cmath>
+
+namespace QUESO {
+
+/*! \class FixedMatrix
+
+    \brief Class for square matrices whose dimension \c N is known at compile time.
+
+    This class offers the subset of the GslMatrix interface that the statistical classes use, so
+    that FixedVector<N> and FixedMatrix<N> can replace GslVector and GslMatrix as their template
+    arguments. Elements are stored by rows in an array member, and the LU and Cholesky
+    factorizations are cached in array members too, so a solve or a determinant never touches the
+    heap. Matrices are N-by-N: the map given to the constructors must have exactly \c N elements.
+*/
+
+template <unsigned int N>
+class FixedMatrix : public Matrix
+{
+public:
+  class BulkWriter;
+  friend class BulkWriter;
+
+  //! @name Constructor/Destructor methods
+  //@{
+  //! Default Constructor
+  /*! Creates an empty matrix of no dimension. It should not be used by user.*/
+  FixedMatrix();
+
+  //! Shaped Constructor: creates a square matrix with \c N rows and \c numCols = \c N columns, filled with zeros.
+  FixedMatrix(const BaseEnvironment& env,
+              const Map&             map,
+              unsigned int           numCols);
+
+  //! Shaped Constructor: creates a square matrix with diagonal values all equal to \c diagValue.
+  FixedMatrix(const BaseEnvironment& env,
+              const Map&             map,
+              double                 diagValue); // MATLAB eye
+
+  //! Shaped Constructor: creates a square matrix with size \c v.sizeLocal() and diagonal values all equal to \c diagValue.
+  FixedMatrix(const FixedVector<N>& v,
+              double                diagValue); // MATLAB eye
+
+  //! Shaped Constructor: creates a square matrix with the elements of \c v on its diagonal.
+  FixedMatrix(const FixedVector<N>& v);         // MATLAB diag
+
+  //! Shaped Constructor: \c this matrix is a copy of matrix \c B.
+  FixedMatrix(const FixedMatrix&    B);
+
+  //! Destructor
+  ~FixedMatrix();
+  //@}
+
+  //! @name Set methods
+  //@{
+  //! Copies values from matrix \c rhs to \c this.
+  FixedMatrix& operator= (const FixedMatrix& rhs);
+
+  //! Stores in \c this the coordinate-wise multiplication of \c this and \c a.
+  FixedMatrix& operator*=(double a);
+
+  //! Stores in \c this the coordinate-wise division of \c this by \c a.
+  FixedMatrix& operator/=(double a);
+
+  //! Stores in \c this the coordinate-wise addition of \c this and \c rhs.
+  FixedMatrix& operator+=(const FixedMatrix& rhs);
+
+  //! Stores in \c this the coordinate-wise subtraction of \c this by \c rhs.
+  FixedMatrix& operator-=(const FixedMatrix& rhs);
+  //@}
+
+  //! @name Accessor methods
+  //@{
+  //! Element access method (non-const).
+  double& operator()(unsigned int i, unsigned int j);
+
+  //! Element access method (const).
+  const double& operator()(unsigned int i, unsigned int j) const;
+
+  //! Element read access, for symmetry with GslMatrix::get().
+  const double& get(unsigned int i, unsigned int j) const;
+  //@}
+
+  //! @name Attribute methods
+  //@{
+  //! Returns the local row dimension of \c this matrix.
+  unsigned int numRowsLocal () const;
+
+  //! Returns the global row dimension of \c this matrix.
+  unsigned int numRowsGlobal() const;
+
+  //! Returns the column dimension of \c this matrix.
+  unsigned int numCols      () const;
+
+  //! Returns the maximum element value of the matrix.
+  double       max          () const;
+
+  //! This function returns the number of singular values of \c this matrix (rank).
+  unsigned int rank         (double absoluteZeroThreshold, double relativeZeroThreshold) const;
+
+  //! This function calculated the transpose of \c this matrix  (square).
+  FixedMatrix  transpose    () const;
+
+  //! This function calculated the inverse of \c this matrix (square).
+  FixedMatrix  inverse      () const;
+
+  //! Calculates the determinant of \c this matrix.
+  double       determinant  () const;
+
+  //! Calculates the ln(determinant) of \c this matrix.
+  /*! When \c this matrix is declared symmetric positive definite, the value is twice the sum of
+   * the logarithms of the diagonal of its Cholesky factor. */
+  double       lnDeterminant() const;
+  //@}
+
+  //! @name Norm methods
+  //@{
+  //! Returns the Frobenius norm of \c this matrix.
+  double       normFrob     () const;
+
+  //! Returns the Frobenius norm of \c this matrix.
+  double       normMax      () const;
+  //@}
+
+  //! @name Mathematical methods
+  //@{
+  //! Computes Cholesky factorization of a real symmetric positive definite matrix \c this.
+  /*! As with GslMatrix, the factor L is stored in the lower triangle and L^T in the upper one.
+   * In case \this fails to be symmetric and positive definite, an error will be returned. */
+  int          chol         ();
+
+  //! Declares \c this matrix symmetric positive definite, with \c cholFactor, the result of chol() on a copy of \c this matrix, as its Cholesky factor.
+  /*! As with GslMatrix, later solves and determinants then reuse \c cholFactor. */
+  void         setCholeskyFactor(const FixedMatrix& cholFactor) const; // Yes, 'const'
+
+  //! Checks for the dimension of \c this matrix, \c matU, \c VecS and \c matVt, and calls the protected routine \c internalSvd to compute the singular values of \c this.
+  int          svd          (FixedMatrix& matU, FixedVector<N>& vecS, FixedMatrix& matVt) const;
+
+  //! This function multiplies \c this matrix by vector \c x and returns the resulting vector.
+  FixedVector<N> multiply   (const FixedVector<N>& x) const;
+
+  //! Multiply \c this matrix by the matrix \c X and stores the result in \c Y.
+  void         multiply     (const FixedMatrix& X, FixedMatrix& Y) const;
+
+  //! This function calculates the inverse of \c this matrix and multiplies it with vector \c b.
+  FixedVector<N> invertMultiply(const FixedVector<N>& b) const;
+
+  //! This function calculates the inverse of \c this matrix, multiplies it with vector \c b and stores the result in vector \c x.
+  /*! The factorization is computed once and cached until \c this matrix changes. A matrix
+   declared symmetric positive definite uses its Cholesky factor instead of the LU one.*/
+  void         invertMultiply(const FixedVector<N>& b, FixedVector<N>& x) const;
+
+  //! This function calculates the inverse of \c this matrix and multiplies it with matrix \c B.
+  FixedMatrix  invertMultiply(const FixedMatrix& B) const;
+
+  //! This function calculates the inverse of \c this matrix, multiplies it with matrix \c B and stores the result in matrix \c X.
+  void         invertMultiply(const FixedMatrix& B, FixedMatrix& X) const;
+
+  //! This function calculates the inverse of \c this matrix and multiplies it with vector \c b.
+  FixedVector<N> invertMultiplyForceLU(const FixedVector<N>& b) const;
+
+  //! This function calculates the inverse of \c this matrix through its LU decomposition, multiplies it with vector \c b and stores the result in vector \c x.
+  void         invertMultiplyForceLU(const FixedVector<N>& b, FixedVector<N>& x) const;
+
+  //! This function computes the eigenvalues of a real symmetric matrix.
+  void         eigen        (FixedVector<N>& eigenValues, FixedMatrix* eigenVectors) const;
+
+  //! This function finds largest eigenvalue, namely \c eigenValue, of \c this matrix and its corresponding eigenvector, namely \c eigenVector.
+  void         largestEigen (double& eigenValue, FixedVector<N>& eigenVector) const;
+
+  //! This function finds smallest eigenvalue, namely \c eigenValue, of \c this matrix and its corresponding eigenvector, namely \c eigenVector.
+  void         smallestEigen(double& eigenValue, FixedVector<N>& eigenVector) const;
+  //@}
+
+  //! @name Get/Set methods
+  //@{
+  //! Component-wise set all values to \c this with value.
+  void         cwSet        (double value);
+
+  //! Set the components of \c which positions are greater than (rowId,colId) with the value of mat(rowId,colId).
+  void         cwSet        (unsigned int rowId, unsigned int colId, const FixedMatrix& mat);
+
+  void         cwExtract    (unsigned int rowId, unsigned int colId, FixedMatrix& mat) const;
+
+  //! This function sets all the entries bellow the main diagonal of \c this matrix to zero.
+  void         zeroLower    (bool includeDiagonal = false);
+
+  //! This function sets all the entries above the main diagonal of \c this matrix to zero.
+  void         zeroUpper    (bool includeDiagonal = false);
+
+  //! This function sets to zero (filters) all entries of \c this matrix which are smaller than \c thresholdValue.
+  void         filterSmallValues(double thresholdValue);
+
+  //! This function sets to zero (filters) all entries of \c this matrix which are greater than \c thresholdValue.
+  void         filterLargeValues(double thresholdValue);
+
+  //! This function stores the transpose of \c this matrix into \c this matrix.
+  void         fillWithTranspose(unsigned int       rowId,
+                                 unsigned int       colId,
+                                 const FixedMatrix& mat,
+                                 bool               checkForExactNumRowsMatching,
+                                 bool               checkForExactNumColsMatching);
+
+  //! This function gets the column_num-th column of \c this matrix and stores it into vector \c column.
+  void         getColumn    (const unsigned int column_num, FixedVector<N>& column) const;
+
+  //! This function gets the column_num-th column of \c this matrix.
+  FixedVector<N> getColumn  (const unsigned int column_num) const;
+
+  //! This function copies vector \c column into the column_num-th column of \c this matrix.
+  void         setColumn    (const unsigned int column_num, const FixedVector<N>& column);
+
+  //! This function gets the row_num-th row of \c this matrix and stores it into vector \c row.
+  void         getRow       (const unsigned int row_num, FixedVector<N>& row) const;
+
+  //! This function gets the row_num-th column of \c this matrix.
+  FixedVector<N> getRow     (const unsigned int row_num) const;
+
+  //! This function copies vector \c row into the row_num-th row of \c this matrix.
+  void         setRow       (const unsigned int row_num, const FixedVector<N>& row);
+  //@}
+
+  //! @name Miscellaneous methods
+  //@{
+  void         mpiSum       (const MpiComm& comm, FixedMatrix& M_global) const;
+  //@}
+
+  //! @name I/O methods
+  //@{
+  //! Print method. Defines the behavior of the ostream << operator inherited from the Object class.
+  void         print        (std::ostream& os) const;
+
+  //! Write contents of subenvironment in file \c fileName.
+  void         subWriteContents(const std::string&            varNamePrefix,
+                                const std::string&            fileName,
+                                const std::string&            fileType,
+                                const std::set<unsigned int>& allowedSubEnvIds) const;
+
+  //! Read contents of subenvironment from file \c fileName.
+  void         subReadContents (const std::string&            fileName,
+                                const std::string&            fileType,
+                                const std::set<unsigned int>& allowedSubEnvIds);
+  //@}
+
+private:
+  //! This function checks that \c map has \c N elements.
+  void         checkMap     (const Map& map, const char* where) const;
+
+  //! In this function \c this matrix receives a copy of matrix \c src.
+  void         copy         (const FixedMatrix& src);
+
+  //! In this function resets the cached factorizations and determinants of \c this matrix.
+  void         resetLU      ();
+
+  //! This function computes and caches the LU decomposition of \c this matrix, with partial pivoting.
+  void         factorizeLU  () const;
+
+  //! This function computes and caches the Cholesky factor of \c this matrix, if it is declared symmetric positive definite.
+  /*! It returns false when the LU decomposition must be used instead. */
+  bool         factorizeCholesky() const;
+
+  //! This function solves the system with the cached LU or Cholesky factor, in place.
+  void         solveInPlace (double* x, bool useChol) const;
+
+  //! Elements of \c this matrix, stored by rows.
+          double m_data[N*N];
+
+  //! LU factors of \c this matrix, with the unit lower factor below the diagonal.
+  mutable double m_LU[N*N];
+
+  //! Row permutation of the LU decomposition.
+  mutable unsigned int m_permutation[N];
+
+  //! Sign of the permutation of the LU decomposition, (-1)^(number of interchanges).
+  mutable int    m_signum;
+
+  //! Lower triangular Cholesky factor of \c this matrix.
+  mutable double m_chol[N*N];
+
+  mutable bool   m_hasLU;
+  mutable bool   m_hasChol;
+  mutable bool   m_cholFailed;
+  mutable double m_determinant;
+  mutable double m_lnDeterminant;
+  mutable bool   m_isSingular;
+
+  //! GSL workspace of eigen(), allocated on its first call and kept until destruction.
+  mutable gsl_eigen_symmv_workspace* m_eigenWorkspace;
+};
+
+//! Scoped write access to all elements of a FixedMatrix.
+/*! Same contract as GslMatrix::BulkWriter: the cached factorizations are reset once, when the
+    writer goes out of scope. */
+template <unsigned int N>
+class FixedMatrix<N>::BulkWriter
+{
+public:
+  explicit BulkWriter(FixedMatrix<N>& matrix) : m_matrix(matrix) {}
+  ~BulkWriter() { m_matrix.resetLU(); }
+
+  //! Pointer to the \c N contiguous elements of row \c i.
+  double* row(unsigned int i) const { return m_matrix.m_data + i*N; }
+
+  double& operator()(unsigned int i, unsigned int j) const { return m_matrix.m_data[i*N + j]; }
+
+private:
+  BulkWriter(const BulkWriter&);
+  BulkWriter& operator=(const BulkWriter&);
+
+  FixedMatrix<N>& m_matrix;
+};
+
+template <unsigned int N>
+inline
+FixedMatrix<N>::FixedMatrix()
+  :
+  Matrix(),
+  m_eigenWorkspace(NULL)
+{
+  UQ_FATAL_TEST_MACRO(true,
+                      m_env.worldRank(),
+                      "FixedMatrix<N>::constructor(), default",
+                      "should not be used by user");
+}
+
+template <unsigned int N>
+inline
+FixedMatrix<N>::FixedMatrix(
+  const BaseEnvironment& env,
+  const Map&             map,
+  unsigned int           nCols)
+  :
+  Matrix(env,map),
+  m_eigenWorkspace(NULL)
+{
+  this->checkMap(map,"FixedMatrix<N>::constructor()");
+  UQ_FATAL_TEST_MACRO(nCols != N,
+                      m_env.worldRank(),
+                      "FixedMatrix<N>::constructor()",
+                      "matrix must be square");
+  this->cwSet(0.);
+}
+
+template <unsigned int N>
+inline
+FixedMatrix<N>::FixedMatrix(
+  const BaseEnvironment& env,
+  const Map&             map,
+  double                 diagValue)
+  :
+  Matrix(env,map),
+  m_eigenWorkspace(NULL)
+{
+  this->checkMap(map,"FixedMatrix<N>::constructor(), eye");
+  this->cwSet(0.);
+  for (unsigned int i = 0; i < N; ++i) {
+    m_data[i*N + i] = diagValue;
+  }
+}
+
+template <unsigned int N>
+inline
+FixedMatrix<N>::FixedMatrix(
+  const FixedVector<N>& v,
+  double                diagValue)
+  :
+  Matrix(v.env(),v.map()),
+  m_eigenWorkspace(NULL)
+{
+  this->cwSet(0.);
+  for (unsigned int i = 0; i < N; ++i) {
+    m_data[i*N + i] = diagValue;
+  }
+}
+
+template <unsigned int N>
+inline
+FixedMatrix<N>::FixedMatrix(const FixedVector<N>& v)
+  :
+  Matrix(v.env(),v.map()),
+  m_eigenWorkspace(NULL)
+{
+  this->cwSet(0.);
+  for (unsigned int i = 0; i < N; ++i) {
+    m_data[i*N + i] = v[i];
+  }
+}
+
+template <unsigned int N>
+inline
+FixedMatrix<N>::FixedMatrix(const FixedMatrix<N>& B)
+  :
+  Matrix(B.env(),B.map()),
+  m_eigenWorkspace(NULL)
+{
+  this->copy(B);
+}
+
+template <unsigned int N>
+inline
+FixedMatrix<N>::~FixedMatrix()
+{
+  if (m_eigenWorkspace) gsl_eigen_symmv_free(m_eigenWorkspace);
+}
+
+template <unsigned int N>
+inline FixedMatrix<N>&
+FixedMatrix<N>::operator=(const FixedMatrix<N>& rhs)
+{
+  this->copy(rhs);
+  return *this;
+}
+
+template <unsigned int N>
+inline FixedMatrix<N>&
+FixedMatrix<N>::operator*=(double a)
+{
+  this->resetLU();
+  for (unsigned int k = 0; k < N*N; ++k) {
+    m_data[k] *= a;
+  }
+  return *this;
+}
+
+template <unsigned int N>
+inline FixedMatrix<N>&
+FixedMatrix<N>::operator/=(double a)
+{
+  *this *= (1./a);
+  return *this;
+}
+
+template <unsigned int N>
+inline FixedMatrix<N>&
+FixedMatrix<N>::operator+=(const FixedMatrix<N>& rhs)
+{
+  this->resetLU();
+  for (unsigned int k = 0; k < N*N; ++k) {
+    m_data[k] += rhs.m_data[k];
+  }
+  return *this;
+}
+
+template <unsigned int N>
+inline FixedMatrix<N>&
+FixedMatrix<N>::operator-=(const FixedMatrix<N>& rhs)
+{
+  this->resetLU();
+  for (unsigned int k = 0; k < N*N; ++k) {
+    m_data[k] -= rhs.m_data[k];
+  }
+  return *this;
+}
+
+template <unsigned int N>
+inline double&
+FixedMatrix<N>::operator()(unsigned int i, unsigned int j)
+{
+  this->resetLU();
+#ifdef DEBUG
+  UQ_FATAL_TEST_MACRO((i >= N) || (j >= N),
+                      m_env.worldRank(),
+                      "FixedMatrix<N>::operator()",
+                      "i or j is too large");
+#endif
+  return m_data[i*N + j];
+}
+
+template <unsigned int N>
+inline const double&
+FixedMatrix<N>::operator()(unsigned int i, unsigned int j) const
+{
+#ifdef DEBUG
+  UQ_FATAL_TEST_MACRO((i >= N) || (j >= N),
+                      m_env.worldRank(),
+                      "FixedMatrix<N>::operator() const",
+                      "i or j is too large");
+#endif
+  return m_data[i*N + j];
+}
+
+template <unsigned int N>
+inline const double&
+FixedMatrix<N>::get(unsigned int i, unsigned int j) const
+{
+  return (*this)(i,j);
+}
+
+template <unsigned int N>
+inline void
+FixedMatrix<N>::checkMap(const Map& map, const char* where) const
+{
+  UQ_FATAL_TEST_MACRO((map.NumGlobalElements() != (int) N) || (map.NumMyElements() != (int) N),
+                      m_env.worldRank(),
+                      where,
+                      "map does not have N elements");
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedMatrix<N>::copy(const FixedMatrix<N>& src)
+{
+  this->Matrix::copy(src);
+  this->resetLU();
+  for (unsigned int k = 0; k < N*N; ++k) {
+    m_data[k] = src.m_data[k];
+  }
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedMatrix<N>::resetLU()
+{
+  m_hasLU         = false;
+  m_hasChol       = false;
+  m_cholFailed    = false;
+  m_signum        = 0;
+  m_determinant   = -INFINITY;
+  m_lnDeterminant = -INFINITY;
+  m_isSingular    = false;
+  return;
+}
+
+template <unsigned int N>
+inline unsigned int
+FixedMatrix<N>::numRowsLocal() const
+{
+  return N;
+}
+
+template <unsigned int N>
+inline unsigned int
+FixedMatrix<N>::numRowsGlobal() const
+{
+  return N;
+}
+
+template <unsigned int N>
+inline unsigned int
+FixedMatrix<N>::numCols() const
+{
+  return N;
+}
+
+template <unsigned int N>
+inline double
+FixedMatrix<N>::max() const
+{
+  double value = -INFINITY;
+  for (unsigned int k = 0; k < N*N; ++k) {
+    if (m_data[k] > value) value = m_data[k];
+  }
+  return value;
+}
+
+template <unsigned int N>
+unsigned int
+FixedMatrix<N>::rank(double absoluteZeroThreshold, double relativeZeroThreshold) const
+{
+  FixedMatrix<N> matU (*this);
+  FixedVector<N> vecS (m_env,m_map);
+  FixedMatrix<N> matVt(*this);
+  int iRC = this->svd(matU,vecS,matVt);
+  if (iRC) {}; // just to remove compiler warning
+
+  double largest = vecS.getMaxValue();
+  unsigned int rankValue = 0;
+  for (unsigned int i = 0; i < N; ++i) {
+    double relative = (largest > 0.) ? vecS[i]/largest : vecS[i];
+    if ((vecS[i] >= absoluteZeroThreshold) &&
+        (relative >= relativeZeroThreshold)) {
+      rankValue += 1;
+    }
+  }
+
+  return rankValue;
+}
+
+template <unsigned int N>
+inline FixedMatrix<N>
+FixedMatrix<N>::transpose() const
+{
+  FixedMatrix<N> mat(*this);
+  for (unsigned int i = 0; i < N; ++i) {
+    for (unsigned int j = 0; j < N; ++j) {
+      mat.m_data[j*N + i] = m_data[i*N + j];
+    }
+  }
+  mat.resetLU();
+  return mat;
+}
+
+template <unsigned int N>
+FixedMatrix<N>
+FixedMatrix<N>::inverse() const
+{
+  FixedMatrix<N> mat(m_env,m_map,1.);
+  bool useChol = this->factorizeCholesky();
+  if (useChol == false) this->factorizeLU();
+  {
+    BulkWriter writer(mat);
+    double column[N];
+    for (unsigned int j = 0; j < N; ++j) {
+      for (unsigned int i = 0; i < N; ++i) {
+        column[i] = (i == j) ? 1. : 0.;
+      }
+      this->solveInPlace(column,useChol);
+      for (unsigned int i = 0; i < N; ++i) {
+        writer(i,j) = column[i];
+      }
+    }
+  }
+  return mat;
+}
+
+template <unsigned int N>
+double
+FixedMatrix<N>::determinant() const
+{
+  if (m_determinant == -INFINITY) {
+    this->lnDeterminant();
+  }
+  return m_determinant;
+}
+
+template <unsigned int N>
+double
+FixedMatrix<N>::lnDeterminant() const
+{
+  if (m_lnDeterminant != -INFINITY) return m_lnDeterminant;
+
+  if (this->factorizeCholesky()) {
+    // det(A) = det(L)^2, and the diagonal of L is positive
+    double lnDiagSum = 0.;
+    for (unsigned int i = 0; i < N; ++i) {
+      lnDiagSum += std::log(m_chol[i*N + i]);
+    }
+    m_lnDeterminant = 2.*lnDiagSum;
+    m_determinant   = std::exp(m_lnDeterminant);
+  }
+  else {
+    // Same values as gsl_linalg_LU_det() and gsl_linalg_LU_lndet()
+    this->factorizeLU();
+    double det       = (double) m_signum;
+    double lnDiagSum = 0.;
+    for (unsigned int i = 0; i < N; ++i) {
+      det       *= m_LU[i*N + i];
+      lnDiagSum += std::log(std::fabs(m_LU[i*N + i]));
+    }
+    m_determinant   = det;
+    m_lnDeterminant = lnDiagSum;
+  }
+
+  return m_lnDeterminant;
+}
+
+template <unsigned int N>
+inline double
+FixedMatrix<N>::normFrob() const
+{
+  double value = 0.;
+  for (unsigned int k = 0; k < N*N; ++k) {
+    value += m_data[k]*m_data[k];
+  }
+  return std::sqrt(value);
+}
+
+template <unsigned int N>
+inline double
+FixedMatrix<N>::normMax() const
+{
+  double value = 0.;
+  for (unsigned int k = 0; k < N*N; ++k) {
+    value = std::max(value,std::fabs(m_data[k]));
+  }
+  return value;
+}
+
+template <unsigned int N>
+int
+FixedMatrix<N>::chol()
+{
+  this->resetLU();
+  int iRC = 0;
+  for (unsigned int j = 0; (iRC == 0) && (j < N); ++j) {
+    double diag = m_data[j*N + j];
+    for (unsigned int k = 0; k < j; ++k) {
+      diag -= m_data[j*N + k]*m_data[j*N + k];
+    }
+    if (diag <= 0.) {
+      iRC = GSL_EDOM;
+      break;
+    }
+    diag = std::sqrt(diag);
+    m_data[j*N + j] = diag;
+    for (unsigned int i = j+1; i < N; ++i) {
+      double value = m_data[i*N + j];
+      for (unsigned int k = 0; k < j; ++k) {
+        value -= m_data[i*N + k]*m_data[j*N + k];
+      }
+      m_data[i*N + j] = value/diag;
+    }
+  }
+  if (iRC == 0) {
+    // Same layout as gsl_linalg_cholesky_decomp(): L^T in the upper triangle
+    for (unsigned int i = 0; i < N; ++i) {
+      for (unsigned int j = i+1; j < N; ++j) {
+        m_data[i*N + j] = m_data[j*N + i];
+      }
+    }
+  }
+  UQ_RC_MACRO(iRC, // Yes, *not* a fatal check on RC
+              m_env.worldRank(),
+              "FixedMatrix<N>::chol()",
+              "matrix is not positive definite",
+              UQ_MATRIX_IS_NOT_POS_DEFINITE_RC);
+
+  return iRC;
+}
+
+template <unsigned int N>
+int
+FixedMatrix<N>::svd(FixedMatrix<N>& matU, FixedVector<N>& vecS, FixedMatrix<N>& matVt) const
+{
+  double dataU[N*N];
+  double dataV[N*N];
+  double dataS[N];
+  for (unsigned int k = 0; k < N*N; ++k) {
+    dataU[k] = m_data[k];
+  }
+  gsl_matrix_view viewU = gsl_matrix_view_array(dataU,N,N);
+  gsl_matrix_view viewV = gsl_matrix_view_array(dataV,N,N);
+  gsl_vector_view viewS = gsl_vector_view_array(dataS,N);
+
+  gsl_error_handler_t* oldHandler;
+  oldHandler = gsl_set_error_handler_off();
+  int iRC = gsl_linalg_SV_decomp_jacobi(&viewU.matrix,&viewV.matrix,&viewS.vector);
+  gsl_set_error_handler(oldHandler);
+  UQ_RC_MACRO(iRC, // Yes, *not* a fatal check on RC
+              m_env.worldRank(),
+              "FixedMatrix<N>::svd()",
+              "matrix svd failed",
+              UQ_MATRIX_SVD_FAILED_RC);
+
+  {
+    BulkWriter writerU (matU);
+    BulkWriter writerVt(matVt);
+    for (unsigned int i = 0; i < N; ++i) {
+      vecS[i] = dataS[i];
+      for (unsigned int j = 0; j < N; ++j) {
+        writerU (i,j) = dataU[i*N + j];
+        writerVt(i,j) = dataV[j*N + i];
+      }
+    }
+  }
+
+  return iRC;
+}
+
+template <unsigned int N>
+inline FixedVector<N>
+FixedMatrix<N>::multiply(const FixedVector<N>& x) const
+{
+  FixedVector<N> y(m_env,m_map);
+  for (unsigned int i = 0; i < N; ++i) {
+    double value = 0.;
+    for (unsigned int j = 0; j < N; ++j) {
+      value += m_data[i*N + j]*x[j];
+    }
+    y[i] = value;
+  }
+  return y;
+}
+
+template <unsigned int N>
+inline void
+FixedMatrix<N>::multiply(const FixedMatrix<N>& X, FixedMatrix<N>& Y) const
+{
+  double result[N*N];
+  for (unsigned int i = 0; i < N; ++i) {
+    for (unsigned int j = 0; j < N; ++j) {
+      double value = 0.;
+      for (unsigned int k = 0; k < N; ++k) {
+        value += m_data[i*N + k]*X.m_data[k*N + j];
+      }
+      result[i*N + j] = value;
+    }
+  }
+  BulkWriter writer(Y);
+  for (unsigned int k = 0; k < N*N; ++k) {
+    Y.m_data[k] = result[k];
+  }
+  return;
+}
+
+template <unsigned int N>
+void
+FixedMatrix<N>::factorizeLU() const
+{
+  if (m_hasLU) return;
+
+  // Doolittle elimination with partial pivoting, as in gsl_linalg_LU_decomp()
+  for (unsigned int k = 0; k < N*N; ++k) {
+    m_LU[k] = m_data[k];
+  }
+  for (unsigned int i = 0; i < N; ++i) {
+    m_permutation[i] = i;
+  }
+  m_signum = 1;
+  for (unsigned int j = 0; j < N; ++j) {
+    unsigned int pivot = j;
+    for (unsigned int i = j+1; i < N; ++i) {
+      if (std::fabs(m_LU[i*N + j]) > std::fabs(m_LU[pivot*N + j])) pivot = i;
+    }
+    if (pivot != j) {
+      for (unsigned int k = 0; k < N; ++k) {
+        std::swap(m_LU[j*N + k],m_LU[pivot*N + k]);
+      }
+      std::swap(m_permutation[j],m_permutation[pivot]);
+      m_signum = -m_signum;
+    }
+    double diag = m_LU[j*N + j];
+    if (diag == 0.) continue;
+    for (unsigned int i = j+1; i < N; ++i) {
+      double factor = m_LU[i*N + j]/diag;
+      m_LU[i*N + j] = factor;
+      for (unsigned int k = j+1; k < N; ++k) {
+        m_LU[i*N + k] -= factor*m_LU[j*N + k];
+      }
+    }
+  }
+  m_hasLU = true;
+
+  return;
+}
+
+template <unsigned int N>
+void
+FixedMatrix<N>::setCholeskyFactor(const FixedMatrix<N>& cholFactor) const
+{
+  this->setSymmetricPositiveDefinite(true);
+  for (unsigned int k = 0; k < N*N; ++k) {
+    m_chol[k] = cholFactor.m_data[k];
+  }
+  m_hasChol    = true;
+  m_cholFailed = false;
+
+  return;
+}
+
+template <unsigned int N>
+bool
+FixedMatrix<N>::factorizeCholesky() const
+{
+  if (m_hasChol) return true;
+  if ((m_symmetricPositiveDefinite == false) ||
+      (m_cholFailed                        )) return false;
+
+  for (unsigned int j = 0; j < N; ++j) {
+    double diag = m_data[j*N + j];
+    for (unsigned int k = 0; k < j; ++k) {
+      diag -= m_chol[j*N + k]*m_chol[j*N + k];
+    }
+    if (diag <= 0.) {
+      // Not numerically positive definite: the LU decomposition is used until the matrix changes
+      if ((m_env.subDisplayFile()) && (m_env.displayVerbosity() >= 2)) {
+        *m_env.subDisplayFile() << "In FixedMatrix<N>::factorizeCholesky()"
+                                << ": non positive pivot at row " << j
+                                << ", using LU decomposition instead"
+                                << std::endl;
+      }
+      m_cholFailed = true;
+      return false;
+    }
+    diag = std::sqrt(diag);
+    m_chol[j*N + j] = diag;
+    for (unsigned int i = j+1; i < N; ++i) {
+      double value = m_data[i*N + j];
+      for (unsigned int k = 0; k < j; ++k) {
+        value -= m_chol[i*N + k]*m_chol[j*N + k];
+      }
+      m_chol[i*N + j] = value/diag;
+    }
+  }
+  m_hasChol = true;
+
+  return true;
+}
+
+template <unsigned int N>
+void
+FixedMatrix<N>::solveInPlace(double* x, bool useChol) const
+{
+  if (useChol) {
+    // L y = b, then L^T x = y
+    for (unsigned int i = 0; i < N; ++i) {
+      double value = x[i];
+      for (unsigned int k = 0; k < i; ++k) {
+        value -= m_chol[i*N + k]*x[k];
+      }
+      x[i] = value/m_chol[i*N + i];
+    }
+    for (unsigned int i = N; i-- > 0; ) {
+      double value = x[i];
+      for (unsigned int k = i+1; k < N; ++k) {
+        value -= m_chol[k*N + i]*x[k];
+      }
+      x[i] = value/m_chol[i*N + i];
+    }
+    return;
+  }
+
+  for (unsigned int i = 0; i < N; ++i) {
+    if (m_LU[i*N + i] == 0.) {
+      m_isSingular = true;
+      std::cerr << "In FixedMatrix<N>::solveInPlace()"
+                << ": matrix is singular"
+                << std::endl;
+      return;
+    }
+  }
+  // P b, then L y = P b, then U x = y
+  double y[N];
+  for (unsigned int i = 0; i < N; ++i) {
+    double value = x[m_permutation[i]];
+    for (unsigned int k = 0; k < i; ++k) {
+      value -= m_LU[i*N + k]*y[k];
+    }
+    y[i] = value;
+  }
+  for (unsigned int i = N; i-- > 0; ) {
+    double value = y[i];
+    for (unsigned int k = i+1; k < N; ++k) {
+      value -= m_LU[i*N + k]*x[k];
+    }
+    x[i] = value/m_LU[i*N + i];
+  }
+
+  return;
+}
+
+template <unsigned int N>
+inline FixedVector<N>
+FixedMatrix<N>::invertMultiply(const FixedVector<N>& b) const
+{
+  FixedVector<N> x(m_env,m_map);
+  this->invertMultiply(b,x);
+  return x;
+}
+
+template <unsigned int N>
+inline void
+FixedMatrix<N>::invertMultiply(const FixedVector<N>& b, FixedVector<N>& x) const
+{
+  bool useChol = this->factorizeCholesky();
+  if (useChol == false) this->factorizeLU();
+
+  double work[N];
+  for (unsigned int i = 0; i < N; ++i) {
+    work[i] = b[i];
+  }
+  this->solveInPlace(work,useChol);
+  for (unsigned int i = 0; i < N; ++i) {
+    x[i] = work[i];
+  }
+
+  return;
+}
+
+template <unsigned int N>
+inline FixedMatrix<N>
+FixedMatrix<N>::invertMultiply(const FixedMatrix<N>& B) const
+{
+  FixedMatrix<N> X(m_env,m_map,N);
+  this->invertMultiply(B,X);
+  return X;
+}
+
+template <unsigned int N>
+void
+FixedMatrix<N>::invertMultiply(const FixedMatrix<N>& B, FixedMatrix<N>& X) const
+{
+  bool useChol = this->factorizeCholesky();
+  if (useChol == false) this->factorizeLU();
+
+  double result[N*N];
+  double column[N];
+  for (unsigned int j = 0; j < N; ++j) {
+    for (unsigned int i = 0; i < N; ++i) {
+      column[i] = B.m_data[i*N + j];
+    }
+    this->solveInPlace(column,useChol);
+    for (unsigned int i = 0; i < N; ++i) {
+      result[i*N + j] = column[i];
+    }
+  }
+  BulkWriter writer(X);
+  for (unsigned int k = 0; k < N*N; ++k) {
+    X.m_data[k] = result[k];
+  }
+
+  return;
+}
+
+template <unsigned int N>
+inline FixedVector<N>
+FixedMatrix<N>::invertMultiplyForceLU(const FixedVector<N>& b) const
+{
+  FixedVector<N> x(m_env,m_map);
+  this->invertMultiplyForceLU(b,x);
+  return x;
+}
+
+template <unsigned int N>
+inline void
+FixedMatrix<N>::invertMultiplyForceLU(const FixedVector<N>& b, FixedVector<N>& x) const
+{
+  this->factorizeLU();
+
+  double work[N];
+  for (unsigned int i = 0; i < N; ++i) {
+    work[i] = b[i];
+  }
+  this->solveInPlace(work,false);
+  for (unsigned int i = 0; i < N; ++i) {
+    x[i] = work[i];
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+FixedMatrix<N>::eigen(FixedVector<N>& eigenValues, FixedMatrix<N>* eigenVectors) const
+{
+  double work[N*N];
+  double values[N];
+  double vectors[N*N];
+  for (unsigned int k = 0; k < N*N; ++k) {
+    work[k] = m_data[k];
+  }
+  gsl_matrix_view workView    = gsl_matrix_view_array(work,N,N);
+  gsl_vector_view valuesView  = gsl_vector_view_array(values,N);
+  gsl_matrix_view vectorsView = gsl_matrix_view_array(vectors,N,N);
+
+  // Eigenvalues only are sorted too, which GslMatrix::eigen() does not promise
+  if (m_eigenWorkspace == NULL) m_eigenWorkspace = gsl_eigen_symmv_alloc((size_t) N);
+  int iRC = gsl_eigen_symmv(&workView.matrix,&valuesView.vector,&vectorsView.matrix,m_eigenWorkspace);
+  gsl_eigen_symmv_sort(&valuesView.vector,&vectorsView.matrix,GSL_EIGEN_SORT_VAL_ASC);
+  if (eigenVectors != NULL) {
+    BulkWriter writer(*eigenVectors);
+    for (unsigned int k = 0; k < N*N; ++k) {
+      writer(k/N,k%N) = vectors[k];
+    }
+  }
+  UQ_FATAL_RC_MACRO(iRC,
+                    m_env.worldRank(),
+                    "FixedMatrix<N>::eigen()",
+                    "failed");
+
+  for (unsigned int i = 0; i < N; ++i) {
+    eigenValues[i] = values[i];
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+FixedMatrix<N>::largestEigen(double& eigenValue, FixedVector<N>& eigenVector) const
+{
+  if (m_symmetricPositiveDefinite) {
+    // Same normalization as the power iteration below: the largest component in absolute value is one
+    FixedVector<N> eigenValues(m_env,m_map);
+    FixedMatrix<N> eigenVectors(m_env,m_map,N);
+    this->eigen(eigenValues,&eigenVectors);
+    eigenValue = eigenValues[N-1];
+    eigenVectors.getColumn(N-1,eigenVector);
+    eigenVector /= eigenVector[(eigenVector.abs()).getMaxValueIndex()];
+    return;
+  }
+
+  // Power iteration, as in GslMatrix::largestEigen()
+  const unsigned int max_num_iterations = 10000;
+  const double tolerance = 1.0e-13;
+
+  FixedVector<N> z(m_env, m_map, 1.0 ); // Needs to be initialized to 1.0
+  FixedVector<N> w(m_env, m_map);
+
+  int index;
+  double residual = INFINITY;
+  double lambda;
+
+  for (unsigned int k = 0; k < max_num_iterations; ++k) {
+    w = this->multiply(z);
+
+    // For this algorithm, it's crucial to get the maximum in
+    // absolute value, but then to normalize by the actual value
+    // and *not* the absolute value.
+    index = (w.abs()).getMaxValueIndex();
+    lambda = w[index];
+    z = (1.0/lambda) * w;
+
+    // Here we use the norm of the residual as our convergence check:
+    // norm( A*x - \lambda*x )
+    residual = ( this->multiply(z) - lambda*z ).norm2();
+    if (residual < tolerance) {
+      eigenValue  = lambda;
+      eigenVector = z;
+      return;
+    }
+  }
+
+  UQ_FATAL_TEST_MACRO((residual >= tolerance),
+                      env().fullRank(),
+                      "FixedMatrix<N>::largestEigen()",
+                      "Maximum num iterations exceeded");
+
+  return;
+}
+
+template <unsigned int N>
+void
+FixedMatrix<N>::smallestEigen(double& eigenValue, FixedVector<N>& eigenVector) const
+{
+  if (m_symmetricPositiveDefinite) {
+    // Same normalization as the inverse power iteration below: the largest component in absolute value is one
+    FixedVector<N> eigenValues(m_env,m_map);
+    FixedMatrix<N> eigenVectors(m_env,m_map,N);
+    this->eigen(eigenValues,&eigenVectors);
+    eigenValue = eigenValues[0];
+    eigenVectors.getColumn(0,eigenVector);
+    eigenVector /= eigenVector[(eigenVector.abs()).getMaxValueIndex()];
+    return;
+  }
+
+  // Inverse power iteration, as in GslMatrix::smallestEigen()
+  const unsigned int max_num_iterations = 1000;
+  const double tolerance = 1.0e-13;
+
+  FixedVector<N> z(m_env, m_map, 1.0 ); // Needs to be initialized to 1.0
+  FixedVector<N> w(m_env, m_map);
+
+  int index;
+  double residual = INFINITY;
+  double lambda;
+
+  for (unsigned int k = 0; k < max_num_iterations; ++k) {
+    this->invertMultiplyForceLU(z,w);
+
+    // Remember: Inverse power method solves for max 1/lambda ==> lambda smallest
+    index = (w.abs()).getMaxValueIndex();
+    lambda = 1.0/w[index];
+    z = lambda * w;
+
+    residual = ( this->multiply(z) - lambda*z ).norm2();
+    if (residual < tolerance) {
+      eigenValue  = lambda;
+      eigenVector = z;
+      return;
+    }
+  }
+
+  UQ_FATAL_TEST_MACRO((residual >= tolerance),
+                      env().fullRank(),
+                      "FixedMatrix<N>::smallestEigen()",
+                      "Maximum num iterations exceeded");
+
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedMatrix<N>::cwSet(double value)
+{
+  this->resetLU();
+  for (unsigned int k = 0; k < N*N; ++k) {
+    m_data[k] = value;
+  }
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedMatrix<N>::cwSet(unsigned int rowId, unsigned int colId, const FixedMatrix<N>& mat)
+{
+  UQ_FATAL_TEST_MACRO((rowId != 0) || (colId != 0),
+                      m_env.worldRank(),
+                      "FixedMatrix<N>::cwSet()",
+                      "invalid rowId or colId");
+  this->copy(mat);
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedMatrix<N>::cwExtract(unsigned int rowId, unsigned int colId, FixedMatrix<N>& mat) const
+{
+  UQ_FATAL_TEST_MACRO((rowId != 0) || (colId != 0),
+                      m_env.worldRank(),
+                      "FixedMatrix<N>::cwExtract()",
+                      "invalid rowId or colId");
+  mat = *this;
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedMatrix<N>::zeroLower(bool includeDiagonal)
+{
+  this->resetLU();
+  for (unsigned int i = 0; i < N; ++i) {
+    for (unsigned int j = 0; j < (includeDiagonal ? i+1 : i); ++j) {
+      m_data[i*N + j] = 0.;
+    }
+  }
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedMatrix<N>::zeroUpper(bool includeDiagonal)
+{
+  this->resetLU();
+  for (unsigned int i = 0; i < N; ++i) {
+    for (unsigned int j = (includeDiagonal ? i : i+1); j < N; ++j) {
+      m_data[i*N + j] = 0.;
+    }
+  }
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedMatrix<N>::filterSmallValues(double thresholdValue)
+{
+  this->resetLU();
+  for (unsigned int k = 0; k < N*N; ++k) {
+    double aux = m_data[k];
+    // If 'thresholdValue' is negative, no values will be filtered
+    if ((aux             < 0. ) &&
+        (-thresholdValue < aux)) {
+      m_data[k] = 0.;
+    }
+    if ((aux            > 0. ) &&
+        (thresholdValue > aux)) {
+      m_data[k] = 0.;
+    }
+  }
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedMatrix<N>::filterLargeValues(double thresholdValue)
+{
+  this->resetLU();
+  for (unsigned int k = 0; k < N*N; ++k) {
+    double aux = m_data[k];
+    // If 'thresholdValue' is negative, no values will be filtered
+    if ((aux             < 0. ) &&
+        (-thresholdValue > aux)) {
+      m_data[k] = 0.;
+    }
+    if ((aux            > 0. ) &&
+        (thresholdValue < aux)) {
+      m_data[k] = 0.;
+    }
+  }
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedMatrix<N>::fillWithTranspose(
+  unsigned int          rowId,
+  unsigned int          colId,
+  const FixedMatrix<N>& mat,
+  bool                  checkForExactNumRowsMatching,
+  bool                  checkForExactNumColsMatching)
+{
+  UQ_FATAL_TEST_MACRO((rowId != 0) || (colId != 0),
+                      m_env.worldRank(),
+                      "FixedMatrix<N>::fillWithTranspose()",
+                      "invalid rowId or colId");
+  if (checkForExactNumRowsMatching) {};
+  if (checkForExactNumColsMatching) {};
+  *this = mat.transpose();
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedMatrix<N>::getColumn(const unsigned int column_num, FixedVector<N>& column) const
+{
+  UQ_FATAL_TEST_MACRO(column_num >= N,
+                      m_env.worldRank(),
+                      "FixedMatrix<N>::getColumn",
+                      "Specified row number not within range");
+  for (unsigned int i = 0; i < N; ++i) {
+    column[i] = m_data[i*N + column_num];
+  }
+  return;
+}
+
+template <unsigned int N>
+inline FixedVector<N>
+FixedMatrix<N>::getColumn(const unsigned int column_num) const
+{
+  FixedVector<N> column(m_env,m_map);
+  this->getColumn(column_num,column);
+  return column;
+}
+
+template <unsigned int N>
+inline void
+FixedMatrix<N>::setColumn(const unsigned int column_num, const FixedVector<N>& column)
+{
+  UQ_FATAL_TEST_MACRO(column_num >= N,
+                      m_env.worldRank(),
+                      "FixedMatrix<N>::setColumn",
+                      "Specified column number not within range");
+  this->resetLU();
+  for (unsigned int i = 0; i < N; ++i) {
+    m_data[i*N + column_num] = column[i];
+  }
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedMatrix<N>::getRow(const unsigned int row_num, FixedVector<N>& row) const
+{
+  UQ_FATAL_TEST_MACRO(row_num >= N,
+                      m_env.worldRank(),
+                      "FixedMatrix<N>::getRow",
+                      "Specified row number not within range");
+  for (unsigned int j = 0; j < N; ++j) {
+    row[j] = m_data[row_num*N + j];
+  }
+  return;
+}
+
+template <unsigned int N>
+inline FixedVector<N>
+FixedMatrix<N>::getRow(const unsigned int row_num) const
+{
+  FixedVector<N> row(m_env,m_map);
+  this->getRow(row_num,row);
+  return row;
+}
+
+template <unsigned int N>
+inline void
+FixedMatrix<N>::setRow(const unsigned int row_num, const FixedVector<N>& row)
+{
+  UQ_FATAL_TEST_MACRO(row_num >= N,
+                      m_env.worldRank(),
+                      "FixedMatrix<N>::setRow",
+                      "Specified row number not within range");
+  this->resetLU();
+  for (unsigned int j = 0; j < N; ++j) {
+    m_data[row_num*N + j] = row[j];
+  }
+  return;
+}
+
+template <unsigned int N>
+void
+FixedMatrix<N>::mpiSum(const MpiComm& comm, FixedMatrix<N>& M_global) const
+{
+  M_global.resetLU();
+  comm.Allreduce((void*) m_data, (void*) M_global.m_data, (int) (N*N), RawValue_MPI_DOUBLE, RawValue_MPI_SUM,
+                 "FixedMatrix<N>::mpiSum()",
+                 "failed MPI.Allreduce()");
+  return;
+}
+
+template <unsigned int N>
+void
+FixedMatrix<N>::print(std::ostream& os) const
+{
+  if (m_printHorizontally) {
+    for (unsigned int i = 0; i < N; ++i) {
+      for (unsigned int j = 0; j < N; ++j) {
+        os << m_data[i*N + j]
+           << " ";
+      }
+      if (i != (N-1)) os << "; ";
+    }
+  }
+  else {
+    for (unsigned int i = 0; i < N; ++i) {
+      for (unsigned int j = 0; j < N; ++j) {
+        os << m_data[i*N + j]
+           << " ";
+      }
+      os << std::endl;
+    }
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+FixedMatrix<N>::subWriteContents(
+  const std::string&            varNamePrefix,
+  const std::string&            fileName,
+  const std::string&            fileType,
+  const std::set<unsigned int>& allowedSubEnvIds) const
+{
+  UQ_FATAL_TEST_MACRO(m_env.subRank() < 0,
+                      m_env.worldRank(),
+                      "FixedMatrix<N>::subWriteContents()",
+                      "unexpected subRank");
+
+  FilePtrSetStruct filePtrSet;
+  if (m_env.openOutputFile(fileName,
+                           fileType, // "m or hdf"
+                           allowedSubEnvIds,
+                           false,
+                           filePtrSet)) {
+    *filePtrSet.ofsVar << varNamePrefix << "_sub" << m_env.subIdString() << " = zeros(" << N
+                       << ","                                                           << N
+                       << ");"
+                       << std::endl;
+    *filePtrSet.ofsVar << varNamePrefix << "_sub" << m_env.subIdString() << " = [";
+
+    for (unsigned int i = 0; i < N; ++i) {
+      for (unsigned int j = 0; j < N; ++j) {
+        *filePtrSet.ofsVar << m_data[i*N + j]
+                << " ";
+      }
+      *filePtrSet.ofsVar << "\n";
+    }
+    *filePtrSet.ofsVar << "];\n";
+
+    m_env.closeFile(filePtrSet,fileType);
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+FixedMatrix<N>::subReadContents(
+  const std::string&            fileName,
+  const std::string&            fileType,
+  const std::set<unsigned int>& allowedSubEnvIds)
+{
+  UQ_FATAL_TEST_MACRO(m_env.subRank() < 0,
+                      m_env.worldRank(),
+                      "FixedMatrix<N>::subReadContents()",
+                      "unexpected subRank");
+
+  FilePtrSetStruct filePtrSet;
+  if (m_env.openInputFile(fileName,
+                          fileType, // "m or hdf"
+                          allowedSubEnvIds,
+                          filePtrSet)) {
+    // Same format as written by subWriteContents():
+    // 'variable_name = zeros(n_rows,n_cols);' followed by 'variable_name = [value1 value2 ...'
+    std::string tmpString;
+    *filePtrSet.ifsVar >> tmpString; // 'variable name'
+    *filePtrSet.ifsVar >> tmpString; // '='
+    UQ_FATAL_TEST_MACRO(tmpString != "=",
+                        m_env.worldRank(),
+                        "FixedMatrix<N>::subReadContents()",
+                        "string should be the '=' sign");
+    *filePtrSet.ifsVar >> tmpString; // 'zeros(n_rows,n_cols);'
+    std::string::size_type commaPos = tmpString.find(',');
+    UQ_FATAL_TEST_MACRO((tmpString.compare(0,6,"zeros(") != 0) || (commaPos == std::string::npos),
+                        m_env.worldRank(),
+                        "FixedMatrix<N>::subReadContents()",
+                        "first line of file should define 'zeros(n_rows,n_cols)'");
+    unsigned int numRowsInFile = (unsigned int) strtod(tmpString.substr(6,commaPos-6).c_str(),NULL);
+    unsigned int numColsInFile = (unsigned int) strtod(tmpString.substr(commaPos+1).c_str(),  NULL);
+    UQ_FATAL_TEST_MACRO((numRowsInFile != N) || (numColsInFile != N),
+                        m_env.worldRank(),
+                        "FixedMatrix<N>::subReadContents()",
+                        "size of matrix in file is different than the size of this matrix object");
+
+    *filePtrSet.ifsVar >> tmpString; // 'variable name'
+    *filePtrSet.ifsVar >> tmpString; // '='
+    UQ_FATAL_TEST_MACRO(tmpString != "=",
+                        m_env.worldRank(),
+                        "FixedMatrix<N>::subReadContents()",
+                        "string should be the '=' sign");
+
+    // Take into account the ' [' portion
+    std::streampos tmpPos = filePtrSet.ifsVar->tellg();
+    filePtrSet.ifsVar->seekg(tmpPos+(std::streampos)2);
+    this->resetLU();
+    for (unsigned int k = 0; k < N*N; ++k) {
+      *filePtrSet.ifsVar >> m_data[k];
+    }
+
+    m_env.closeFile(filePtrSet,fileType);
+  }
+
+  return;
+}
+
+// Comments in this part of file don't appear in the doxygen docs.
+
+template <unsigned int N>
+inline std::ostream&
+operator<<(std::ostream& os, const FixedMatrix<N>& obj)
+{
+  obj.print(os);
+  return os;
+}
+
+template <unsigned int N>
+inline FixedMatrix<N>
+operator*(double a, const FixedMatrix<N>& mat)
+{
+  FixedMatrix<N> answer(mat);
+  answer *= a;
+  return answer;
+}
+
+template <unsigned int N>
+inline FixedVector<N>
+operator*(const FixedMatrix<N>& mat, const FixedVector<N>& vec)
+{
+  return mat.multiply(vec);
+}
+
+template <unsigned int N>
+inline FixedMatrix<N>
+operator*(const FixedMatrix<N>& m1, const FixedMatrix<N>& m2)
+{
+  FixedMatrix<N> answer(m1);
+  m1.multiply(m2,answer);
+  return answer;
+}
+
+template <unsigned int N>
+inline FixedMatrix<N>
+operator+(const FixedMatrix<N>& m1, const FixedMatrix<N>& m2)
+{
+  FixedMatrix<N> answer(m1);
+  answer += m2;
+  return answer;
+}
+
+template <unsigned int N>
+inline FixedMatrix<N>
+operator-(const FixedMatrix<N>& m1, const FixedMatrix<N>& m2)
+{
+  FixedMatrix<N> answer(m1);
+  answer -= m2;
+  return answer;
+}
+
+template <unsigned int N>
+inline FixedMatrix<N>
+matrixProduct(const FixedVector<N>& v1, const FixedVector<N>& v2)
+{
+  FixedMatrix<N> answer(v1,0.);
+  {
+    typename FixedMatrix<N>::BulkWriter writer(answer);
+    for (unsigned int i = 0; i < N; ++i) {
+      for (unsigned int j = 0; j < N; ++j) {
+        writer(i,j) = v1[i]*v2[j];
+      }
+    }
+  }
+  return answer;
+}
+
+// Row \c i of the returned matrix is equal to row \c i of \c mat multiplied by element \c i of \c v.
+template <unsigned int N>
+inline FixedMatrix<N>
+leftDiagScaling(const FixedVector<N>& vec, const FixedMatrix<N>& mat)
+{
+  FixedMatrix<N> answer(mat);
+  {
+    typename FixedMatrix<N>::BulkWriter writer(answer);
+    for (unsigned int i = 0; i < N; ++i) {
+      for (unsigned int j = 0; j < N; ++j) {
+        writer(i,j) *= vec[i];
+      }
+    }
+  }
+  return answer;
+}
+
+// Column \c j of the returned matrix is equal to column \c j of \c mat multiplied by element \c j of \c v.
+template <unsigned int N>
+inline FixedMatrix<N>
+rightDiagScaling(const FixedMatrix<N>& mat, const FixedVector<N>& vec)
+{
+  FixedMatrix<N> answer(mat);
+  {
+    typename FixedMatrix<N>::BulkWriter writer(answer);
+    for (unsigned int i = 0; i < N; ++i) {
+      for (unsigned int j = 0; j < N; ++j) {
+        writer(i,j) *= vec[j];
+      }
+    }
+  }
+  return answer;
+}
+
+}  // End namespace QUESO
+
+#endif // UQ_FIXED_MATRIX_H
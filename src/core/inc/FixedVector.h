@@ -0,0 +1,1045 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008,2009,2010,2011,2012,2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef UQ_FIXED_VECTOR_H
+#define UQ_FIXED_VECTOR_H
+
+/*! \file FixedVector.h
+    \brief Vector class with a size fixed at compile time
+*/
+
+#include <queso/Defines.h>
+#include <queso/Vector.h>
+#include <queso/RngBase.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+namespace QUESO {
+
+/*! \class FixedVector
+
+    \brief Class for vectors whose size \c N is known at compile time.
+
+    This class offers the interface of GslVector, so that it can replace GslVector as the
+    template argument of the statistical classes (e.g. MetropolisHastingsSG) in problems with
+    few parameters. Its components are kept in an array member instead of a heap allocated
+    gsl_vector, so that temporaries live on the stack, and every loop has a constant trip
+    count that the compiler can unroll. The map given to the constructors must have exactly
+    \c N elements.
+*/
+
+template <unsigned int N>
+class FixedVector : public Vector
+{
+public:
+
+  //! @name Constructor/Destructor methods.
+  //@{
+
+  //! Default Constructor
+  /*! Creates an empty vector of no length.*/
+  FixedVector();
+
+  FixedVector(const BaseEnvironment& env, const Map& map);
+  FixedVector(const BaseEnvironment& env, const Map& map, double value);
+  FixedVector(const BaseEnvironment& env, double d1, double d2, const Map& map); // MATLAB linspace
+
+  //! Construct a vector, with length the same as \c v, with evenly spaced numbers from \c start to \c end, inclusive
+  FixedVector(const FixedVector&       v, double start, double end);
+  FixedVector(const FixedVector&       y);
+
+  //! Destructor
+  ~FixedVector();
+  //@}
+
+  //! @name Set methods.
+  //@{
+  //! Copies values from vector rhs to \c this.
+  FixedVector& operator= (const FixedVector& rhs);
+
+  //! Stores in \c this the coordinate-wise multiplication of \c this and a.
+  FixedVector& operator*=(double a);
+
+  //! Stores in \c this the coordinate-wise division of \c this by a.
+  FixedVector& operator/=(double a);
+
+  //! Stores in \c this the coordinate-wise multiplication of \c this with rhs.
+  FixedVector& operator*=(const FixedVector& rhs);
+
+  //! Stores in \c this the coordinate-wise division of \c this by rhs.
+  FixedVector& operator/=(const FixedVector& rhs);
+
+  //! Stores in \c this the coordinate-wise addition of \c this and rhs.
+  FixedVector& operator+=(const FixedVector& rhs);
+
+  //! Stores in \c this the coordinate-wise subtraction of \c this by rhs.
+  FixedVector& operator-=(const FixedVector& rhs);
+  //@}
+
+  //! @name Accessor methods.
+  //@{
+  //! Element access method (non-const).
+        double& operator[](unsigned int i);
+
+  //! Element access method (const).
+  const double& operator[](unsigned int i) const;
+  //@}
+
+  //! @name Attribute methods.
+  //@{
+  //! Returns the length of this vector.
+  unsigned int sizeLocal        () const;
+
+  //! Returns the global length of this vector.
+  unsigned int sizeGlobal       () const;
+  //@}
+
+  //! @name Norm methods.
+  //@{
+  //! Returns the 2-norm squared of this vector.
+  double       norm2Sq          () const;
+
+  //! Returns the 2-norm (Euclidean norm) of the vector.
+  double       norm2            () const;
+
+  //! Returns the 1-norm of the vector.
+  double       norm1            () const;
+
+  //! Returns the infinity-norm (maximum norm) of the vector.
+  double       normInf          () const;
+  //@}
+
+  //! @name Comparison methods.
+  //@{
+  //! Returns the sum of the components of the vector.
+  double       sumOfComponents  () const;
+  //@}
+
+  //! @name Set methods.
+  //@{
+  //! Component-wise sets all values to \c this with value.
+  void         cwSet            (double value);
+
+  //! Component-wise sets all values of \c this with Gaussian samples of mean \c mean and standard deviation \c stdDev.
+  void         cwSetGaussian    (double mean, double stdDev);
+
+  //! Component-wise sets all values of \c this with Gaussian samples of means \c meanVec and standard deviations \c stdDevVec.
+  void         cwSetGaussian    (const FixedVector& meanVec, const FixedVector& stdDevVec);
+
+  //! Component-wise sets all values of \c this with uniform samples in the intervals [\c aVec, \c bVec].
+  void         cwSetUniform     (const FixedVector& aVec, const FixedVector& bVec);
+
+  //! Component-wise sets all values of \c this with Beta samples of parameters \c alpha and \c beta.
+  void         cwSetBeta        (const FixedVector& alpha, const FixedVector& beta);
+
+  //! Component-wise sets all values of \c this with Gamma samples of parameters \c a and \c b.
+  void         cwSetGamma       (const FixedVector& a, const FixedVector& b);
+
+  //! Component-wise sets all values of \c this with Inverse Gamma samples of parameters \c alpha and \c beta.
+  void         cwSetInverseGamma(const FixedVector& alpha, const FixedVector& beta);
+
+  //! Sets the values of \c this starting at position \c initialPos with the values of \c vec.
+  void         cwSet            (unsigned int initialPos, const FixedVector& vec);
+
+  //! Extracts the values of \c this starting at position \c initialPos into \c vec.
+  void         cwExtract        (unsigned int initialPos, FixedVector& vec) const;
+
+  //! This function inverts component-wise the element values of \c this.
+  void         cwInvert         ();
+
+  //! This function returns component-wise the square-root of \c this.
+  void         cwSqrt           ();
+  //@}
+
+  //! @name I/O methods.
+  //@{
+  //! Print method.  Defines the behavior of the std::ostream << operator inherited from the Object class.
+  void         print            (std::ostream& os) const;
+  //@}
+
+  //! This function sorts the elements of the vector \c this in ascending numerical order.
+  void         sort             ();
+
+  void         matlabDiff       (unsigned int firstPositionToStoreDiff, double valueForRemainderPosition, FixedVector& outputVec) const;
+  void         mpiBcast         (int srcRank, const MpiComm& bcastComm);
+  void         mpiAllReduce     (RawType_MPI_Op mpiOperation, const MpiComm& opComm, FixedVector& resultVec) const;
+  void         mpiAllQuantile   (double probability, const MpiComm& opComm, FixedVector& resultVec) const;
+  void         subWriteContents (const std::string&            varNamePrefix,
+                                 const std::string&            fileName,
+                                 const std::string&            fileType,
+                                 const std::set<unsigned int>& allowedSubEnvIds) const;
+  void         subReadContents  (const std::string&            fileName,
+                                 const std::string&            fileType,
+                                 const std::set<unsigned int>& allowedSubEnvIds);
+
+  //! @name Comparison methods.
+  //@{
+  //! This function returns true if at least one component of \c this is smaller than the respective component of rhs.
+  bool         atLeastOneComponentSmallerThan       (const FixedVector& rhs) const;
+
+  //! This function returns true if at least one component of \c this is bigger than the respective component of rhs.
+  bool         atLeastOneComponentBiggerThan        (const FixedVector& rhs) const;
+
+  //! This function returns true if at least one component of \c this is smaller than or equal to the respective component of rhs.
+  bool         atLeastOneComponentSmallerOrEqualThan(const FixedVector& rhs) const;
+
+  //! This function returns true if at least one component of \c this is bigger than or equal to the respective component of rhs.
+  bool         atLeastOneComponentBiggerOrEqualThan (const FixedVector& rhs) const;
+
+  //! This function returns true if at least one component of \c this is smaller than the respective component of \c lower or bigger than the respective component of \c upper.
+  bool         atLeastOneComponentOutside           (const FixedVector& lower, const FixedVector& upper) const;
+  //@}
+
+  //! @name Attribute methods.
+  //@{
+  //! Returns the maximum value in the vector \c this.
+  double       getMaxValue      () const;
+
+  //! Returns minimum value in the vector \c this.
+  double       getMinValue      () const;
+
+  //! This function returns the index of the maximum value in the vector \c this.
+  int          getMaxValueIndex () const;
+
+  //! This function returns the index of the minimum value in the vector \c this.
+  int          getMinValueIndex () const;
+
+  //! This function returns maximum value in the vector \c this and its the index.
+  void         getMaxValueAndIndex( double& value, int& index );
+
+  //! This function returns minimum value in the vector \c this and its the index.
+  void         getMinValueAndIndex( double& value, int& index );
+
+  //! This function returns absolute value of elements in \c this.
+  FixedVector  abs() const;
+  //@}
+
+private:
+  //! This function checks that \c map has \c N elements.
+  void         checkMap         (const Map& map, const char* where) const;
+
+  //! This function copies the elements of the vector src into \c this.
+  void         copy             (const FixedVector& src);
+
+  //! Components of \c this vector.
+  double m_data[N];
+};
+
+template <unsigned int N>
+inline
+FixedVector<N>::FixedVector()
+  :
+  Vector()
+{
+  UQ_FATAL_TEST_MACRO(true,
+                      m_env.worldRank(),
+                      "FixedVector<N>::constructor(), default",
+                      "should not be used by user");
+}
+
+template <unsigned int N>
+inline
+FixedVector<N>::FixedVector(const BaseEnvironment& env, const Map& map)
+  :
+  Vector(env,map)
+{
+  this->checkMap(map,"FixedVector<N>::constructor(1)");
+  this->cwSet(0.);
+}
+
+template <unsigned int N>
+inline
+FixedVector<N>::FixedVector(const BaseEnvironment& env, const Map& map, double value)
+  :
+  Vector(env,map)
+{
+  this->checkMap(map,"FixedVector<N>::constructor(2)");
+  this->cwSet(value);
+}
+
+template <unsigned int N>
+inline
+FixedVector<N>::FixedVector(const BaseEnvironment& env, double d1, double d2, const Map& map)
+  :
+  Vector(env,map)
+{
+  this->checkMap(map,"FixedVector<N>::constructor(3)");
+  for (unsigned int i = 0; i < N; ++i) {
+    double alpha = (double) i / ((double) N - 1.);
+    m_data[i] = (1.-alpha)*d1 + alpha*d2;
+  }
+}
+
+template <unsigned int N>
+inline
+FixedVector<N>::FixedVector(const FixedVector<N>& v, double start, double end)
+  :
+  Vector(v.env(),v.map())
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    double alpha = (double) i / ((double) N - 1.);
+    m_data[i] = (1.-alpha)*start + alpha*end;
+  }
+}
+
+template <unsigned int N>
+inline
+FixedVector<N>::FixedVector(const FixedVector<N>& v)
+  :
+  Vector(v.env(),v.map())
+{
+  this->copy(v);
+}
+
+template <unsigned int N>
+inline
+FixedVector<N>::~FixedVector()
+{
+}
+
+template <unsigned int N>
+inline FixedVector<N>&
+FixedVector<N>::operator=(const FixedVector<N>& rhs)
+{
+  this->copy(rhs);
+  return *this;
+}
+
+template <unsigned int N>
+inline FixedVector<N>&
+FixedVector<N>::operator*=(double a)
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    m_data[i] *= a;
+  }
+  return *this;
+}
+
+template <unsigned int N>
+inline FixedVector<N>&
+FixedVector<N>::operator/=(double a)
+{
+  *this *= (1./a);
+  return *this;
+}
+
+template <unsigned int N>
+inline FixedVector<N>&
+FixedVector<N>::operator*=(const FixedVector<N>& rhs)
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    m_data[i] *= rhs.m_data[i];
+  }
+  return *this;
+}
+
+template <unsigned int N>
+inline FixedVector<N>&
+FixedVector<N>::operator/=(const FixedVector<N>& rhs)
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    m_data[i] /= rhs.m_data[i];
+  }
+  return *this;
+}
+
+template <unsigned int N>
+inline FixedVector<N>&
+FixedVector<N>::operator+=(const FixedVector<N>& rhs)
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    m_data[i] += rhs.m_data[i];
+  }
+  return *this;
+}
+
+template <unsigned int N>
+inline FixedVector<N>&
+FixedVector<N>::operator-=(const FixedVector<N>& rhs)
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    m_data[i] -= rhs.m_data[i];
+  }
+  return *this;
+}
+
+template <unsigned int N>
+inline double&
+FixedVector<N>::operator[](unsigned int i)
+{
+#ifdef DEBUG
+  UQ_FATAL_TEST_MACRO(i >= N,
+                      m_env.worldRank(),
+                      "FixedVector<N>::operator[]",
+                      "i is too large");
+#endif
+  return m_data[i];
+}
+
+template <unsigned int N>
+inline const double&
+FixedVector<N>::operator[](unsigned int i) const
+{
+#ifdef DEBUG
+  UQ_FATAL_TEST_MACRO(i >= N,
+                      m_env.worldRank(),
+                      "FixedVector<N>::operator[] const",
+                      "i is too large");
+#endif
+  return m_data[i];
+}
+
+template <unsigned int N>
+inline void
+FixedVector<N>::checkMap(const Map& map, const char* where) const
+{
+  UQ_FATAL_TEST_MACRO((map.NumGlobalElements() != (int) N) || (map.NumMyElements() != (int) N),
+                      m_env.worldRank(),
+                      where,
+                      "map does not have N elements");
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedVector<N>::copy(const FixedVector<N>& src)
+{
+  this->Vector::copy(src);
+  for (unsigned int i = 0; i < N; ++i) {
+    m_data[i] = src.m_data[i];
+  }
+  return;
+}
+
+template <unsigned int N>
+inline unsigned int
+FixedVector<N>::sizeLocal() const
+{
+  return N;
+}
+
+template <unsigned int N>
+inline unsigned int
+FixedVector<N>::sizeGlobal() const
+{
+  return N;
+}
+
+template <unsigned int N>
+inline double
+FixedVector<N>::norm2Sq() const
+{
+  return scalarProduct(*this,*this);
+}
+
+template <unsigned int N>
+inline double
+FixedVector<N>::norm2() const
+{
+  return std::sqrt(this->norm2Sq());
+}
+
+template <unsigned int N>
+inline double
+FixedVector<N>::norm1() const
+{
+  double result = 0.;
+  for (unsigned int i = 0; i < N; ++i) {
+    result += std::fabs(m_data[i]);
+  }
+  return result;
+}
+
+template <unsigned int N>
+inline double
+FixedVector<N>::normInf() const
+{
+  double result = 0.;
+  for (unsigned int i = 0; i < N; ++i) {
+    result = std::max(result,std::fabs(m_data[i]));
+  }
+  return result;
+}
+
+template <unsigned int N>
+inline double
+FixedVector<N>::sumOfComponents() const
+{
+  double result = 0.;
+  for (unsigned int i = 0; i < N; ++i) {
+    result += m_data[i];
+  }
+  return result;
+}
+
+template <unsigned int N>
+inline void
+FixedVector<N>::cwSet(double value)
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    m_data[i] = value;
+  }
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedVector<N>::cwSetGaussian(double mean, double stdDev)
+{
+  m_env.rngObject()->gaussianSamples(m_data,N,stdDev);
+  for (unsigned int i = 0; i < N; ++i) {
+    m_data[i] += mean;
+  }
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedVector<N>::cwSetGaussian(const FixedVector<N>& meanVec, const FixedVector<N>& stdDevVec)
+{
+  m_env.rngObject()->gaussianSamples(m_data,N,1.);
+  for (unsigned int i = 0; i < N; ++i) {
+    m_data[i] = meanVec.m_data[i] + stdDevVec.m_data[i]*m_data[i];
+  }
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedVector<N>::cwSetUniform(const FixedVector<N>& aVec, const FixedVector<N>& bVec)
+{
+  m_env.rngObject()->uniformSamples(m_data,N);
+  for (unsigned int i = 0; i < N; ++i) {
+    m_data[i] = aVec.m_data[i] + (bVec.m_data[i]-aVec.m_data[i])*m_data[i];
+  }
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedVector<N>::cwSetBeta(const FixedVector<N>& alpha, const FixedVector<N>& beta)
+{
+  m_env.rngObject()->betaSamples(alpha.m_data,beta.m_data,m_data,N);
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedVector<N>::cwSetGamma(const FixedVector<N>& a, const FixedVector<N>& b)
+{
+  m_env.rngObject()->gammaSamples(a.m_data,b.m_data,m_data,N);
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedVector<N>::cwSetInverseGamma(const FixedVector<N>& alpha, const FixedVector<N>& beta)
+{
+  double scales[N];
+  for (unsigned int i = 0; i < N; ++i) {
+    scales[i] = 1./beta.m_data[i];
+  }
+  m_env.rngObject()->gammaSamples(alpha.m_data,scales,m_data,N);
+  for (unsigned int i = 0; i < N; ++i) {
+    m_data[i] = 1./m_data[i];
+  }
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedVector<N>::cwSet(unsigned int initialPos, const FixedVector<N>& vec)
+{
+  UQ_FATAL_TEST_MACRO(initialPos != 0,
+                      m_env.worldRank(),
+                      "FixedVector<N>::cwSet()",
+                      "invalid initialPos");
+  this->copy(vec);
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedVector<N>::cwExtract(unsigned int initialPos, FixedVector<N>& vec) const
+{
+  UQ_FATAL_TEST_MACRO(initialPos != 0,
+                      m_env.worldRank(),
+                      "FixedVector<N>::cwExtract()",
+                      "invalid initialPos");
+  vec = *this;
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedVector<N>::cwInvert()
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    m_data[i] = 1./m_data[i];
+  }
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedVector<N>::cwSqrt()
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    m_data[i] = std::sqrt(m_data[i]);
+  }
+  return;
+}
+
+template <unsigned int N>
+void
+FixedVector<N>::print(std::ostream& os) const
+{
+  std::ostream::fmtflags curr_fmt = os.flags();
+  const char* separator = m_printHorizontally ? " " : "\n";
+
+  if (m_printScientific) {
+    unsigned int savedPrecision = os.precision();
+    os.precision(16);
+    for (unsigned int i = 0; i < N; ++i) {
+      os << std::scientific << m_data[i] << separator;
+    }
+    os.precision(savedPrecision);
+  }
+  else {
+    for (unsigned int i = 0; i < N; ++i) {
+      os << std::dec << m_data[i] << separator;
+    }
+  }
+
+  os.flags(curr_fmt);
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedVector<N>::sort()
+{
+  std::sort(m_data,m_data+N);
+  return;
+}
+
+template <unsigned int N>
+void
+FixedVector<N>::matlabDiff(
+  unsigned int          firstPositionToStoreDiff,
+  double                valueForRemainderPosition,
+  FixedVector<N>&       outputVec) const
+{
+  UQ_FATAL_TEST_MACRO(firstPositionToStoreDiff > 1,
+                      m_env.worldRank(),
+                      "FixedVector<N>::matlabDiff()",
+                      "invalid firstPositionToStoreDiff");
+
+  for (unsigned int i = 0; i < (N-1); ++i) {
+    outputVec[firstPositionToStoreDiff+i] = m_data[i+1]-m_data[i];
+  }
+  if (firstPositionToStoreDiff == 0) {
+    outputVec[N-1] = valueForRemainderPosition;
+  }
+  else {
+    outputVec[0] = valueForRemainderPosition;
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+FixedVector<N>::mpiBcast(int srcRank, const MpiComm& bcastComm)
+{
+  // Filter out those nodes that should not participate
+  if (bcastComm.MyPID() < 0) return;
+
+  UQ_FATAL_TEST_MACRO((srcRank < 0) || (srcRank >= bcastComm.NumProc()),
+                      m_env.worldRank(),
+                      "FixedVector<N>::mpiBcast()",
+                      "invalid srcRank");
+
+  // All participant nodes have the same vector size, by construction
+  bcastComm.Bcast((void *) m_data, (int) N, RawValue_MPI_DOUBLE, srcRank,
+                  "FixedVector<N>::mpiBcast()",
+                  "failed MPI.Bcast()");
+
+  return;
+}
+
+template <unsigned int N>
+void
+FixedVector<N>::mpiAllReduce(RawType_MPI_Op mpiOperation, const MpiComm& opComm, FixedVector<N>& resultVec) const
+{
+  // Filter out those nodes that should not participate
+  if (opComm.MyPID() < 0) return;
+
+  opComm.Allreduce((void *) m_data, (void *) resultVec.m_data, (int) N, RawValue_MPI_DOUBLE, mpiOperation,
+                   "FixedVector<N>::mpiAllReduce()",
+                   "failed MPI.Allreduce()");
+
+  return;
+}
+
+template <unsigned int N>
+void
+FixedVector<N>::mpiAllQuantile(double probability, const MpiComm& opComm, FixedVector<N>& resultVec) const
+{
+  // Filter out those nodes that should not participate
+  if (opComm.MyPID() < 0) return;
+
+  UQ_FATAL_TEST_MACRO((probability < 0.) || (1. < probability),
+                      m_env.worldRank(),
+                      "FixedVector<N>::mpiAllQuantile()",
+                      "invalid input");
+
+  for (unsigned int i = 0; i < N; ++i) {
+    double auxDouble = (int) m_data[i];
+    std::vector<double> vecOfDoubles(opComm.NumProc(),0.);
+    opComm.Gather((void *) &auxDouble, 1, RawValue_MPI_DOUBLE, (void *) &vecOfDoubles[0], (int) 1, RawValue_MPI_DOUBLE, 0,
+                  "FixedVector<N>::mpiAllQuantile()",
+                  "failed MPI.Gather()");
+
+    std::sort(vecOfDoubles.begin(), vecOfDoubles.end());
+
+    double result = vecOfDoubles[(unsigned int)( probability*((double)(vecOfDoubles.size()-1)) )];
+
+    opComm.Bcast((void *) &result, (int) 1, RawValue_MPI_DOUBLE, 0,
+                 "FixedVector<N>::mpiAllQuantile()",
+                 "failed MPI.Bcast()");
+
+    resultVec[i] = result;
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+FixedVector<N>::subWriteContents(
+  const std::string&            varNamePrefix,
+  const std::string&            fileName,
+  const std::string&            fileType,
+  const std::set<unsigned int>& allowedSubEnvIds) const
+{
+  UQ_FATAL_TEST_MACRO(m_env.subRank() < 0,
+                      m_env.worldRank(),
+                      "FixedVector<N>::subWriteContents()",
+                      "unexpected subRank");
+
+  FilePtrSetStruct filePtrSet;
+  if (m_env.openOutputFile(fileName,
+                           fileType, // "m or hdf"
+                           allowedSubEnvIds,
+                           false,
+                           filePtrSet)) {
+    *filePtrSet.ofsVar << varNamePrefix << "_sub" << m_env.subIdString() << " = zeros(" << N
+                       << ","                                                           << 1
+                       << ");"
+                       << std::endl;
+    *filePtrSet.ofsVar << varNamePrefix << "_sub" << m_env.subIdString() << " = [";
+
+    bool savedVectorPrintScientific   = this->getPrintScientific();
+    bool savedVectorPrintHorizontally = this->getPrintHorizontally();
+    this->setPrintScientific  (true);
+    this->setPrintHorizontally(false);
+    *filePtrSet.ofsVar << *this;
+    this->setPrintHorizontally(savedVectorPrintHorizontally);
+    this->setPrintScientific  (savedVectorPrintScientific);
+
+    *filePtrSet.ofsVar << "];\n";
+
+    m_env.closeFile(filePtrSet,fileType);
+  }
+
+  return;
+}
+
+template <unsigned int N>
+void
+FixedVector<N>::subReadContents(
+  const std::string&            fileName,
+  const std::string&            fileType,
+  const std::set<unsigned int>& allowedSubEnvIds)
+{
+  UQ_FATAL_TEST_MACRO(m_env.subRank() < 0,
+                      m_env.worldRank(),
+                      "FixedVector<N>::subReadContents()",
+                      "unexpected subRank");
+
+  FilePtrSetStruct filePtrSet;
+  if (m_env.openInputFile(fileName,
+                          fileType, // "m or hdf"
+                          allowedSubEnvIds,
+                          filePtrSet)) {
+    // Same format as written by subWriteContents():
+    // 'variable_name = zeros(n_positions,1);' followed by 'variable_name = [value1 value2 ...'
+    std::string tmpString;
+    *filePtrSet.ifsVar >> tmpString; // 'variable name'
+    *filePtrSet.ifsVar >> tmpString; // '='
+    UQ_FATAL_TEST_MACRO(tmpString != "=",
+                        m_env.worldRank(),
+                        "FixedVector<N>::subReadContents()",
+                        "string should be the '=' sign");
+    *filePtrSet.ifsVar >> tmpString; // 'zeros(n_positions,n_params);'
+    std::string::size_type commaPos = tmpString.find(',');
+    UQ_FATAL_TEST_MACRO((tmpString.compare(0,6,"zeros(") != 0) || (commaPos == std::string::npos),
+                        m_env.worldRank(),
+                        "FixedVector<N>::subReadContents()",
+                        "first line of file should define 'zeros(n_positions,n_params)'");
+    unsigned int sizeOfVecInFile = (unsigned int) strtod(tmpString.substr(6,commaPos-6).c_str(),NULL);
+    unsigned int numParamsInFile = (unsigned int) strtod(tmpString.substr(commaPos+1).c_str(),  NULL);
+    UQ_FATAL_TEST_MACRO(sizeOfVecInFile < N,
+                        m_env.worldRank(),
+                        "FixedVector<N>::subReadContents()",
+                        "size of vec in file is not big enough");
+    UQ_FATAL_TEST_MACRO(numParamsInFile != 1,
+                        m_env.worldRank(),
+                        "FixedVector<N>::subReadContents()",
+                        "number of parameters of vec in file is different than number of parameters in this vec object");
+
+    *filePtrSet.ifsVar >> tmpString; // 'variable name'
+    *filePtrSet.ifsVar >> tmpString; // '='
+    UQ_FATAL_TEST_MACRO(tmpString != "=",
+                        m_env.worldRank(),
+                        "FixedVector<N>::subReadContents()",
+                        "string should be the '=' sign");
+
+    // Take into account the ' [' portion
+    std::streampos tmpPos = filePtrSet.ifsVar->tellg();
+    filePtrSet.ifsVar->seekg(tmpPos+(std::streampos)2);
+    for (unsigned int i = 0; i < N; ++i) {
+      *filePtrSet.ifsVar >> m_data[i];
+    }
+
+    m_env.closeFile(filePtrSet,fileType);
+  }
+
+  return;
+}
+
+template <unsigned int N>
+inline bool
+FixedVector<N>::atLeastOneComponentSmallerThan(const FixedVector<N>& rhs) const
+{
+  bool result = false;
+  for (unsigned int i = 0; i < N; ++i) {
+    result |= (m_data[i] < rhs.m_data[i]);
+  }
+  return result;
+}
+
+template <unsigned int N>
+inline bool
+FixedVector<N>::atLeastOneComponentBiggerThan(const FixedVector<N>& rhs) const
+{
+  bool result = false;
+  for (unsigned int i = 0; i < N; ++i) {
+    result |= (m_data[i] > rhs.m_data[i]);
+  }
+  return result;
+}
+
+template <unsigned int N>
+inline bool
+FixedVector<N>::atLeastOneComponentSmallerOrEqualThan(const FixedVector<N>& rhs) const
+{
+  bool result = false;
+  for (unsigned int i = 0; i < N; ++i) {
+    result |= (m_data[i] <= rhs.m_data[i]);
+  }
+  return result;
+}
+
+template <unsigned int N>
+inline bool
+FixedVector<N>::atLeastOneComponentBiggerOrEqualThan(const FixedVector<N>& rhs) const
+{
+  bool result = false;
+  for (unsigned int i = 0; i < N; ++i) {
+    result |= (m_data[i] >= rhs.m_data[i]);
+  }
+  return result;
+}
+
+template <unsigned int N>
+inline bool
+FixedVector<N>::atLeastOneComponentOutside(const FixedVector<N>& lower, const FixedVector<N>& upper) const
+{
+  bool result = false;
+  for (unsigned int i = 0; i < N; ++i) {
+    result |= (m_data[i] < lower.m_data[i]) | (m_data[i] > upper.m_data[i]);
+  }
+  return result;
+}
+
+template <unsigned int N>
+inline double
+FixedVector<N>::getMaxValue() const
+{
+  return m_data[this->getMaxValueIndex()];
+}
+
+template <unsigned int N>
+inline double
+FixedVector<N>::getMinValue() const
+{
+  return m_data[this->getMinValueIndex()];
+}
+
+template <unsigned int N>
+inline int
+FixedVector<N>::getMaxValueIndex() const
+{
+  return (int) (std::max_element(m_data,m_data+N) - m_data);
+}
+
+template <unsigned int N>
+inline int
+FixedVector<N>::getMinValueIndex() const
+{
+  return (int) (std::min_element(m_data,m_data+N) - m_data);
+}
+
+template <unsigned int N>
+inline void
+FixedVector<N>::getMaxValueAndIndex(double& max_value, int& max_value_index)
+{
+  max_value_index = this->getMaxValueIndex();
+  max_value       = m_data[max_value_index];
+  return;
+}
+
+template <unsigned int N>
+inline void
+FixedVector<N>::getMinValueAndIndex(double& min_value, int& min_value_index)
+{
+  min_value_index = this->getMinValueIndex();
+  min_value       = m_data[min_value_index];
+  return;
+}
+
+template <unsigned int N>
+inline FixedVector<N>
+FixedVector<N>::abs() const
+{
+  FixedVector<N> answer(*this);
+  for (unsigned int i = 0; i < N; ++i) {
+    answer.m_data[i] = std::fabs(m_data[i]);
+  }
+  return answer;
+}
+
+// Comments in this part of file don't appear in the doxygen docs.
+
+template <unsigned int N>
+inline std::ostream&
+operator<<(std::ostream& os, const FixedVector<N>& obj)
+{
+  obj.print(os);
+  return os;
+}
+
+template <unsigned int N>
+inline FixedVector<N>
+operator/(double a, const FixedVector<N>& x)
+{
+  FixedVector<N> answer(x);
+  answer.cwInvert();
+  answer *= a;
+  return answer;
+}
+
+template <unsigned int N>
+inline FixedVector<N>
+operator/(const FixedVector<N>& x, const FixedVector<N>& y)
+{
+  FixedVector<N> answer(x);
+  answer /= y;
+  return answer;
+}
+
+template <unsigned int N>
+inline FixedVector<N>
+operator*(double a, const FixedVector<N>& x)
+{
+  FixedVector<N> answer(x);
+  answer *= a;
+  return answer;
+}
+
+template <unsigned int N>
+inline FixedVector<N>
+operator*(const FixedVector<N>& x, const FixedVector<N>& y)
+{
+  FixedVector<N> answer(x);
+  answer *= y;
+  return answer;
+}
+
+template <unsigned int N>
+inline double
+scalarProduct(const FixedVector<N>& x, const FixedVector<N>& y)
+{
+  double result = 0.;
+  for (unsigned int i = 0; i < N; ++i) {
+    result += x[i]*y[i];
+  }
+  return result;
+}
+
+template <unsigned int N>
+inline FixedVector<N>
+operator+(const FixedVector<N>& x, const FixedVector<N>& y)
+{
+  FixedVector<N> answer(x);
+  answer += y;
+  return answer;
+}
+
+template <unsigned int N>
+inline FixedVector<N>
+operator-(const FixedVector<N>& x, const FixedVector<N>& y)
+{
+  FixedVector<N> answer(x);
+  answer -= y;
+  return answer;
+}
+
+template <unsigned int N>
+inline bool
+operator==(const FixedVector<N>& lhs, const FixedVector<N>& rhs)
+{
+  for (unsigned int i = 0; i < N; ++i) {
+    if (lhs[i] != rhs[i]) return false;
+  }
+  return true;
+}
+
+}  // End namespace QUESO
+
+#endif // UQ_FIXED_VECTOR_H
@@ -47,6 +47,9 @@ namespace QUESO {
 class GslMatrix : public Matrix
 {
 public:
+  class BulkWriter;
+  friend class BulkWriter;
+
  //! @name Constructor/Destructor methods
   //@{ 
 
@@ -107,7 +110,10 @@ public:
             
   //! Element access method (const).  
   const double& operator()(unsigned int i, unsigned int j) const;
-  
+
+  //! Element access method (const), for loops that read many entries.
+  /*! Bounds are only checked when QUESO is compiled with DEBUG. */
+  const double& get                       (unsigned int i, unsigned int j) const;
  
   //@}
 
@@ -133,6 +139,7 @@ public:
   GslMatrix  transpose                 () const;
 	
   //! This function calculated the inverse of \c this matrix (square).
+  /*! It goes through the Cholesky factor of \c this matrix, when it is declared symmetric positive definite. */
   GslMatrix  inverse                   () const;
   
     
@@ -140,6 +147,8 @@ public:
   double            determinant               () const;
 	
   //! Calculates the ln(determinant) of \c this matrix.
+  /*! When \c this matrix is declared symmetric positive definite, the value is twice the sum of
+   * the logarithms of the diagonal of its Cholesky factor. */
   double            lnDeterminant             () const;
   
   //@}
@@ -161,8 +170,13 @@ public:
   //@{ 
 
   //! Computes Cholesky factorization of a real symmetric positive definite matrix \c this. 
-  /*! In case \this fails to be symmetric and positive definite, an error will be returned. */
+  /*! In case \this fails to be symmetric and positive definite, an error will be returned.
+   * Large matrices are factored by blocks, so that most of the work goes through level 3 BLAS. */
   int               chol                      ();
+
+  //! Declares \c this matrix symmetric positive definite, with \c cholFactor, the result of chol() on a copy of \c this matrix, as its Cholesky factor.
+  /*! Later solves, determinants and smallestEigen() then reuse \c cholFactor instead of factoring \c this matrix again. */
+  void              setCholeskyFactor         (const GslMatrix& cholFactor) const; // Yes, 'const'
 	
 //! Checks for the dimension of \c this matrix, \c matU, \c VecS and \c matVt, and calls the protected routine \c internalSvd to compute the singular values of \c this. 
   int               svd                       (GslMatrix& matU, GslVector& vecS, GslMatrix& matVt) const;
@@ -186,13 +200,17 @@ public:
   //! This function multiplies \c this matrix by vector \c x and returns the resulting vector.
   GslVector  multiply                  (const GslVector& x) const;
 
+  //! This function multiplies \c this matrix by matrix \c X and stores the resulting matrix in \c Y.
+  /*! It calls the BLAS routine dgemm, through GSL. */
+  void              multiply                  (const GslMatrix& X, GslMatrix& Y) const;
+
   //! This function calculates the inverse of \c this matrix and multiplies it with vector \c b. 
   /*! It calls void GslMatrix::invertMultiply(const GslVector& b, GslVector& x) internally.*/
   GslVector  invertMultiply            (const GslVector& b) const;
 	
   //! This function calculates the inverse of \c this matrix, multiplies it with vector \c b and stores the result in vector \c x.
   /*! It checks for a previous LU decomposition of \c this matrix and does not recompute it
-   if m_MU != NULL .*/
+   if m_MU != NULL . A matrix declared symmetric positive definite uses its cached Cholesky factor instead.*/
   void              invertMultiply            (const GslVector& b, GslVector& x) const;
 	
   //! This function calculates the inverse of \c this matrix and multiplies it with matrix \c B.
@@ -201,7 +219,8 @@ public:
 
   //! This function calculates the inverse of \c this matrix, multiplies it with matrix \c B and stores the result in matrix \c X.
   /*! It checks for a previous LU decomposition of \c this matrix and does not recompute it
-   if m_MU != NULL .*/
+   if m_MU != NULL . All columns of \c B are solved together by triangular solves with multiple
+   right hand sides (BLAS dtrsm), in place in \c X, which may be \c B itself.*/
   void              invertMultiply            (const GslMatrix& B, GslMatrix& X) const;
   
   //! This function calculates the inverse of \c this matrix and multiplies it with vector \c b. 
@@ -235,11 +254,23 @@ GslVector& x) internally.*/
   void              eigen                     (GslVector& eigenValues, GslMatrix* eigenVectors) const;
 	
   //! This function finds largest eigenvalue, namely \c eigenValue, of \c this matrix and its corresponding eigenvector, namely \c eigenVector.
+  /*! A matrix declared symmetric positive definite uses the Lanczos method, or its cached symmetric
+   * eigendecomposition if it already has one. */
   void              largestEigen              (double& eigenValue, GslVector& eigenVector) const;
  
   //! This function finds smallest eigenvalue, namely \c eigenValue, of \c this matrix and its corresponding eigenvector, namely \c eigenVector.
+  /*! A matrix declared symmetric positive definite uses the Lanczos method on its inverse, through the cached
+   * Cholesky factor, or its cached symmetric eigendecomposition if it already has one. */
   void              smallestEigen             (double& eigenValue, GslVector& eigenVector) const;
 
+  //! This function finds an extreme eigenpair of \c this symmetric positive definite matrix with the Lanczos method.
+  /*! The largest eigenvalue is found from the Krylov space of \c this matrix. The smallest one is found from
+   * the Krylov space of its inverse, applied through the cached Cholesky factor. It returns false when the
+   * full eigendecomposition must be used instead: the Cholesky factorization failed, or the Krylov space
+   * became invariant before the extreme eigenvalue could be told apart. The eigenvector is not normalized
+   * as in largestEigen() and smallestEigen(), which call this function.*/
+  bool              lanczosExtremeEigen       (bool smallest, double& eigenValue, GslVector& eigenVector) const;
+
  
   //@} 
   
@@ -378,6 +409,16 @@ private:
 	
   //! This function multiplies \c this matrix by vector \c x and stores the resulting vector in \c y.
   void              multiply                  (const GslVector& x, GslVector& y) const;
+
+  //! This function computes the LU decomposition of \c this matrix, if there is no previous one.
+  void              factorizeLU               () const;
+
+  //! This function computes the Cholesky factor of \c this matrix, if it is declared symmetric positive definite and there is no previous one.
+  /*! It returns false when the LU decomposition must be used instead. */
+  bool              factorizeCholesky         () const;
+
+  //! This function computes the eigendecomposition of \c this symmetric matrix, if there is no previous one.
+  void              factorizeSymmetricEigen   () const;
         
   //! This function factorizes the M-by-N matrix A into the singular value decomposition A = U S V^T for M >= N. On output the matrix A is replaced by U.
   int               internalSvd               () const;
@@ -387,6 +428,18 @@ private:
 	  
   //! GSL matrix for the LU decomposition of m_mat.	  
   mutable gsl_matrix*       m_LU;
+
+  //! GSL matrix for the Cholesky factor of m_mat, in the layout of gsl_linalg_cholesky_decomp().
+  mutable gsl_matrix*       m_chol;
+
+  //! Indicates whether the Cholesky factorization of m_mat failed since m_mat last changed.
+  mutable bool              m_cholFailed;
+
+  //! Eigenvalues of \c this symmetric matrix, in ascending order.
+  mutable GslVector* m_eigenValues;
+
+  //! Eigenvectors of \c this symmetric matrix, stored as columns in the order of m_eigenValues.
+  mutable GslMatrix* m_eigenVectors;
   
   //! Inverse matrix of \c this.
   mutable GslMatrix* m_inverse;
@@ -441,6 +494,82 @@ private:
   mutable bool              m_isSingular;
 };
 
+//! Scoped write access to the entries of a GslMatrix.
+/*! Every write through the non-const GslMatrix::operator() resets the LU decomposition, the
+ * inverse and the singular value decomposition kept by the matrix. A BulkWriter gives access to
+ * the rows of the matrix instead, and resets those factorizations once, when it is destroyed.
+ * The matrix should not be otherwise used while a BulkWriter on it exists. */
+class GslMatrix::BulkWriter
+{
+public:
+  //! Constructor: gives write access to the entries of \c matrix.
+  explicit BulkWriter(GslMatrix& matrix);
+
+  //! Destructor: resets the factorizations of the matrix.
+  ~BulkWriter();
+
+  //! Returns the entries of row \c i, which are contiguous.
+  double* row       (unsigned int i) const;
+
+  //! Element access method. Bounds are only checked when QUESO is compiled with DEBUG.
+  double& operator()(unsigned int i, unsigned int j) const;
+
+private:
+  BulkWriter(const BulkWriter&);
+  BulkWriter& operator=(const BulkWriter&);
+
+  GslMatrix& m_matrix;
+};
+
+inline const double&
+GslMatrix::get(unsigned int i, unsigned int j) const
+{
+#ifdef DEBUG
+  UQ_FATAL_TEST_MACRO((i >= m_mat->size1) || (j >= m_mat->size2),
+                      m_env.worldRank(),
+                      "GslMatrix::get()",
+                      "(i,j) is out of bounds");
+#endif
+  return m_mat->data[i*m_mat->tda + j];
+}
+
+inline
+GslMatrix::BulkWriter::BulkWriter(GslMatrix& matrix)
+  :
+  m_matrix(matrix)
+{
+}
+
+inline
+GslMatrix::BulkWriter::~BulkWriter()
+{
+  m_matrix.resetLU();
+}
+
+inline double*
+GslMatrix::BulkWriter::row(unsigned int i) const
+{
+#ifdef DEBUG
+  UQ_FATAL_TEST_MACRO(i >= m_matrix.m_mat->size1,
+                      m_matrix.m_env.worldRank(),
+                      "GslMatrix::BulkWriter::row()",
+                      "i is too large");
+#endif
+  return m_matrix.m_mat->data + i*m_matrix.m_mat->tda;
+}
+
+inline double&
+GslMatrix::BulkWriter::operator()(unsigned int i, unsigned int j) const
+{
+#ifdef DEBUG
+  UQ_FATAL_TEST_MACRO((i >= m_matrix.m_mat->size1) || (j >= m_matrix.m_mat->size2),
+                      m_matrix.m_env.worldRank(),
+                      "GslMatrix::BulkWriter::operator()",
+                      "(i,j) is out of bounds");
+#endif
+  return m_matrix.m_mat->data[i*m_matrix.m_mat->tda + j];
+}
+
 GslMatrix operator*       (double a,                    const GslMatrix& mat);
 GslVector operator*       (const GslMatrix& mat, const GslVector& vec);
 GslMatrix operator*       (const GslMatrix& m1,  const GslMatrix& m2 );
@@ -208,6 +208,9 @@ public:
   
   //! This function returns true if at least one component of \c this is bigger than or equal to the respective component of rhs. 
   bool         atLeastOneComponentBiggerOrEqualThan (const GslVector& rhs) const;
+
+  //! This function returns true if at least one component of \c this is smaller than the respective component of \c lower or bigger than the respective component of \c upper.
+  bool         atLeastOneComponentOutside           (const GslVector& lower, const GslVector& upper) const;
   //@}
 
   // Necessary for GslMatrix::invertMultiply() and GslMatrix::setRow/Column
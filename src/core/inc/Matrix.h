@@ -127,6 +127,14 @@ public:
           
   //! Checks if QUESO will run through this class in debug mode.        
           bool                    getInDebugMode      ()           const;
+
+  //! Declares whether this matrix is symmetric positive definite, as every covariance matrix is.
+  /*! Matrix classes may then factor the matrix by Cholesky instead of LU, falling back to LU if the
+   * Cholesky factorization fails. The declaration is not copied along with the matrix entries. */
+          void                    setSymmetricPositiveDefinite(bool value) const; // Yes, 'const'
+
+  //! Checks if this matrix has been declared symmetric positive definite.
+          bool                    getSymmetricPositiveDefinite()           const;
   //@}
   
 protected:
@@ -153,6 +161,9 @@ protected:
   
   //! Flag for either or not QUESO is in debug mode.
   mutable bool                    m_inDebugMode;
+
+  //! Flag for either or not this matrix has been declared symmetric positive definite.
+  mutable bool                    m_symmetricPositiveDefinite;
 };
 
 }  // End namespace QUESO
@@ -166,6 +166,19 @@ public:
                                void *recvbuf, int *recvcnts, int *displs, RawType_MPI_Datatype recvtype, 
                                int root,
                                const char* whereMsg, const char* whatMsg) const;
+
+ //! Gathers into specified locations from all processes in a group, and distributes the result to all of them
+ /*! \param sendbuf starting address of send buffer
+  * \param sendcount number of elements in send buffer 
+  * \param sendtype data type of send buffer elements 
+  * \param recvcounts integer array (of length group size) containing the number of elements 
+  * that are received from each process
+  * \param displs integer array (of length group size). Entry i specifies the displacement 
+  * relative to recvbuf at which to place the incoming data from process i 
+  * \param recvtype data type of recv buffer elements */
+  void               Allgatherv(void *sendbuf, int sendcnt, RawType_MPI_Datatype sendtype, 
+                                void *recvbuf, int *recvcnts, int *displs, RawType_MPI_Datatype recvtype, 
+                                const char* whereMsg, const char* whatMsg) const;
 			       
   //! Blocking receive of data from this process to another process. 
   /*!\param buf (output) initial address of receive buffer
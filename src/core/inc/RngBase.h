@@ -79,6 +79,22 @@ public:
   //! Samples a value from a Gamma distribution.
   virtual double gammaSample   (double a, double b)        const = 0;
 
+  //! Fills \c samples with \c numSamples values from a uniform distribution.
+  /*! The default implementation calls uniformSample() \c numSamples times; derived classes
+   * override it to avoid the per sample virtual call.*/
+  virtual void   uniformSamples (double* samples, unsigned int numSamples) const;
+  
+  //! Fills \c samples with \c numSamples values from a Gaussian distribution with standard deviation \c stdDev.
+  /*! The default implementation calls gaussianSample() \c numSamples times; derived classes
+   * override it to avoid the per sample virtual call.*/
+  virtual void   gaussianSamples(double* samples, unsigned int numSamples, double stdDev) const;
+  
+  //! Fills \c samples with \c numSamples values, the i-th one from a Beta distribution with parameters \c alphas[i] and \c betas[i].
+  virtual void   betaSamples    (const double* alphas, const double* betas, double* samples, unsigned int numSamples) const;
+  
+  //! Fills \c samples with \c numSamples values, the i-th one from a Gamma distribution with parameters \c as[i] and \c bs[i].
+  virtual void   gammaSamples   (const double* as, const double* bs, double* samples, unsigned int numSamples) const;
+
   //@}
 protected:
   //! Seed.
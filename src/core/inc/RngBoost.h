@@ -69,7 +69,7 @@ public:
   /*! This function samples from continuous uniform distribution on the range [0,1). It is
    * possible to scale this distribution so the support is defined by the two parameters, 
    * a and b, which are its minimum and maximum values. Support: -infinity < a < x< b< infinity.
-   * Uses boost::uniform_01<boost::mt19937> zeroone(m_rng).*/
+   * Uses boost::uniform_01<> on the object's own engine m_rng.*/
   double   uniformSample ()                          const;
   
   
@@ -106,8 +106,9 @@ private:
    *  as it has not been initialized yet. mt19937 has length cycle of 2^(19937)-1, requires 
    * approximately 625*sizeof(uint32_t) of memory, has relatively high speed (93% of the 
    * fastest available in Boost library), and provides good uniform distribution in up to 
-   * 623 dimensions. */
-  boost::mt19937 m_rng; // it cannot be static, as it is not initialized yet
+   * 623 dimensions. It is mutable because drawing a sample advances its state; each sampling
+   * method draws from it directly, so every object has its own stream and resetSeed() takes effect. */
+  mutable boost::mt19937 m_rng; // it cannot be static, as it is not initialized yet
 };
 
 }  // End namespace QUESO
@@ -102,6 +102,18 @@ public:
    * (domain): [0,infinity).*/
   double   gammaSample   (double a, double b)        const;
 
+  //! Fills \c samples with \c numSamples values from a uniform distribution, using gsl_rng_uniform().
+  void     uniformSamples (double* samples, unsigned int numSamples) const;
+
+  //! Fills \c samples with \c numSamples values from a Gaussian distribution, using gsl_ran_gaussian().
+  void     gaussianSamples(double* samples, unsigned int numSamples, double stdDev) const;
+
+  //! Fills \c samples with \c numSamples values from Beta distributions, using gsl_ran_beta().
+  void     betaSamples    (const double* alphas, const double* betas, double* samples, unsigned int numSamples) const;
+
+  //! Fills \c samples with \c numSamples values from Gamma distributions, using gsl_ran_gamma().
+  void     gammaSamples   (const double* as, const double* bs, double* samples, unsigned int numSamples) const;
+
   //! GSL random number generator.
   const gsl_rng* rng           () const;
 
@@ -0,0 +1,148 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008,2009,2010,2011,2012,2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef UQ_RNG_PHILOX_H
+#define UQ_RNG_PHILOX_H
+
+#include <queso/RngBase.h>
+#include <boost/cstdint.hpp>
+
+/*! \file RngPhilox.h
+    \brief Counter-based Random Number Generation class.
+*/
+
+/*! \class RngPhilox
+    \brief Class for counter-based random number generation (Philox4x32-10).
+    
+    This class implements the Philox4x32-10 generator of Salmon et al., "Parallel random numbers:
+    as easy as 1, 2, 3" (SC'11). Each output block is a bijective function of a 128-bit counter
+    and a 64-bit key, so the generator state is just a counter: it is cheap to create, to copy and
+    to reseed, and independent streams are obtained by reserving a part of the counter for a
+    stream identifier. The seed goes in the key; the upper 64 bits of the counter hold the stream
+    identifier and the lower 64 bits the position inside the stream.
+*/
+
+namespace QUESO {
+
+class RngPhilox : public RngBase
+{
+public:
+  //! @name Constructor/Destructor methods
+  //@{ 
+  //! Default Constructor: it should not be used.
+  RngPhilox();
+  
+  //! Constructor with seed, using stream 0.
+  RngPhilox(int seed, int worldRank);
+  
+  //! Constructor with seed and stream identifier \c streamId.
+  /*! Objects with the same seed and different stream identifiers produce independent sequences.*/
+  RngPhilox(int seed, int worldRank, boost::uint64_t streamId);
+  
+  //! Destructor
+ ~RngPhilox();
+  //@}
+ 
+  //! @name Sampling methods
+  //@{ 
+  //! Resets the seed with value \c newSeed, and rewinds the stream to its beginning.
+  void     resetSeed      (int newSeed);
+  
+  //! Stream identifier.
+  boost::uint64_t streamId() const;
+  
+  //! Samples a value from a uniform distribution. Support: (0,1).
+  /*! Each sample uses 64 bits of generator output, and has 53 random bits. Zero and one are never
+   * returned.*/
+  double   uniformSample  ()                          const;
+  
+  //! Samples a value from a Gaussian distribution with standard deviation given by \c stdDev.  
+  //! Support:  (-infinity, infinity).
+  /*! Uses the Box-Muller transform; the second variate of each pair is kept for the next call.*/
+  double   gaussianSample (double stdDev)             const;
+    
+  //! Samples a value from a Beta distribution. Support: [0,1]
+  /*! Computed as X/(X+Y), with X and Y Gamma distributed with shapes \c alpha and \c beta.*/
+  double   betaSample     (double alpha, double beta) const;
+  
+  //! Samples a value from a Gamma distribution with shape \c a and scale \c b. Support: [0,infinity).
+  /*! Uses the method of Marsaglia and Tsang (2000).*/
+  double   gammaSample    (double a, double b)        const;
+
+  //! Fills \c samples with \c numSamples values from a uniform distribution.
+  /*! Produces the same values as \c numSamples consecutive calls to uniformSample().*/
+  void     uniformSamples (double* samples, unsigned int numSamples) const;
+
+  //! Fills \c samples with \c numSamples values from a Gaussian distribution with standard deviation \c stdDev.
+  /*! Produces the same values as \c numSamples consecutive calls to gaussianSample(). The
+   * uniforms of all complete Box-Muller pairs are drawn first into \c samples, and then
+   * transformed in place in a separate loop without any generator state, which the compiler can
+   * vectorize.*/
+  void     gaussianSamples(double* samples, unsigned int numSamples, double stdDev) const;
+
+  //! Fills \c samples with \c numSamples values from Beta distributions, see betaSample().
+  void     betaSamples    (const double* alphas, const double* betas, double* samples, unsigned int numSamples) const;
+
+  //! Fills \c samples with \c numSamples values from Gamma distributions, see gammaSample().
+  void     gammaSamples   (const double* as, const double* bs, double* samples, unsigned int numSamples) const;
+  //@}
+
+private:
+  //! Computes the next output block, and advances the counter.
+  void     generateBlock  () const;
+
+  //! Next uniform variate in (0,1), taken from the current output block.
+  double   nextUniform    () const;
+
+  //! Next standard Gaussian variate.
+  double   nextGaussian   () const;
+
+  //! Gamma variate with shape \c a and scale \c b.
+  double   nextGamma      (double a, double b) const;
+
+  //! Key of the generator: the seed.
+  boost::uint32_t         m_key[2];
+
+  //! Stream identifier: the upper 64 bits of the counter.
+  boost::uint64_t         m_streamId;
+
+  //! Position inside the stream: the lower 64 bits of the counter.
+  mutable boost::uint64_t m_blockId;
+
+  //! Current output block.
+  mutable boost::uint32_t m_block[4];
+
+  //! Number of uniform variates already taken from the current output block (0, 1 or 2).
+  mutable unsigned int    m_blockPos;
+
+  //! Whether the second variate of the last Box-Muller pair is still available.
+  mutable bool            m_hasSpareGaussian;
+
+  //! Second variate of the last Box-Muller pair, with unit standard deviation.
+  mutable double          m_spareGaussian;
+};
+
+}  // End namespace QUESO
+
+#endif // UQ_RNG_PHILOX_H
@@ -30,6 +30,7 @@
 #include <Teuchos_SerialDenseVector.hpp>
 #include <Teuchos_SerialDenseMatrix.hpp>
 #include <Teuchos_LAPACK.hpp>
+#include <Teuchos_BLAS.hpp>
 #endif
 
 #include <queso/Matrix.h>
@@ -53,6 +54,9 @@ namespace QUESO {
 class TeuchosMatrix : public Matrix
 {
 public:
+  class BulkWriter;
+  friend class BulkWriter;
+
    //! @name Constructor/Destructor methods
   //@{ 
 
@@ -109,6 +113,9 @@ public:
   
   //! Element access method (const).  
   const double& operator()(unsigned int i, unsigned int j) const;
+
+  //! Element access method (const). Bounds are only checked when QUESO is compiled with DEBUG.
+  const double& get(unsigned int i, unsigned int j) const;
   //@}
 
   //! @name Attribute methods
@@ -191,10 +198,15 @@ public:
   
   //! This function multiplies \c this matrix by vector \c x and returns a vector.
   TeuchosVector  multiply                  (const TeuchosVector& x) const;
+
+  //! This function multiplies \c this matrix by matrix \c X and stores the resulting matrix in \c Y.
+  /*! It calls the BLAS routine dgemm, through Teuchos. */
+  void                  multiply                  (const TeuchosMatrix& X, TeuchosMatrix& Y) const;
   
   //! This function calculates the inverse of \c this matrix, multiplies it with vector \c b and stores the result in vector \c x.
   /*! It checks for a previous LU decomposition of \c this matrix and does not recompute it
-   if private attribute m_LU != NULL .*/
+   if private attribute m_LU is not empty. If \c this matrix was declared symmetric positive definite,
+   a cached Cholesky factorization is used instead, as in GslMatrix. */
   void                  invertMultiply            (const TeuchosVector& b, TeuchosVector& x) const;
   
   //! This function calculates the inverse of \c this matrix and multiplies it with vector \c b. 
@@ -202,7 +214,8 @@ public:
   TeuchosVector  invertMultiply            (const TeuchosVector& b) const;
   
   //! This function calculates the inverse of \c this matrix, multiplies it with matrix \c B and stores the result in matrix \c X.
-  /*! It checks for a previous LU decomposition of \c this matrix and does not recompute it if private attribute \c m_LU != NULL .*/
+  /*! It uses the same cached factorization as the vector version, and solves for all columns of
+   \c B in a single LAPACK call. \c X may be the same matrix as \c B. */
   void                  invertMultiply            (const TeuchosMatrix& B, TeuchosMatrix& X) const;
   
   //! This function calculates the inverse of \c this matrix and multiplies it with matrix \c B.
@@ -336,6 +349,14 @@ private:
   
   //! In this function resets the LU decomposition of \c this matrix, as well as deletes the private member pointers, if existing.	
   void              resetLU                   ();
+
+  //! Computes the LU decomposition of \c this matrix into \c m_LU and \c v_pivoting, if not yet computed.
+  void              factorizeLU               () const;
+
+  //! Computes the Cholesky factor of \c this matrix into \c m_chol, if not yet computed.
+  /*! Only done if \c this matrix was declared symmetric positive definite. Returns false if the
+   * matrix was not declared so, or if the factorization failed. */
+  bool              factorizeCholesky         () const;
   
   //! This function multiplies \c this matrix by vector \c x and stores the resulting vector in \c y.
   void              multiply                  (const TeuchosVector& x, TeuchosVector& y) const;
@@ -354,6 +375,12 @@ private:
   
   //! Teuchos matrix for the LU decomposition of m_mat.	  
   mutable Teuchos::SerialDenseMatrix<int,double> m_LU; 
+
+  //! Cholesky factor of m_mat (lower triangle), if m_mat was declared symmetric positive definite.
+  mutable Teuchos::SerialDenseMatrix<int,double> m_chol;
+
+  //! Indicates that the Cholesky factorization failed, so that it is not attempted again until m_mat changes.
+  mutable bool              m_cholFailed;
   
   //! Stores the inverse of \c this matrix.
   mutable TeuchosMatrix* m_inverse;
@@ -391,6 +418,65 @@ private:
   mutable bool              m_isSingular;
 };
 
+//! Scoped write access to the entries of a TeuchosMatrix.
+/*! See GslMatrix::BulkWriter. The Teuchos storage is column major, so only element access is
+ * provided. The factorizations of the matrix are reset once, when the writer is destroyed. */
+class TeuchosMatrix::BulkWriter
+{
+public:
+  //! Constructor: gives write access to the entries of \c matrix.
+  explicit BulkWriter(TeuchosMatrix& matrix);
+
+  //! Destructor: resets the factorizations of the matrix.
+  ~BulkWriter();
+
+  //! Element access method. Bounds are only checked when QUESO is compiled with DEBUG.
+  double& operator()(unsigned int i, unsigned int j) const;
+
+private:
+  BulkWriter(const BulkWriter&);
+  BulkWriter& operator=(const BulkWriter&);
+
+  TeuchosMatrix& m_matrix;
+};
+
+inline const double&
+TeuchosMatrix::get(unsigned int i, unsigned int j) const
+{
+#ifdef DEBUG
+  UQ_FATAL_TEST_MACRO((i >= (unsigned int) m_mat.numRows()) || (j >= (unsigned int) m_mat.numCols()),
+                      m_env.worldRank(),
+                      "TeuchosMatrix::get()",
+                      "(i,j) is out of bounds");
+#endif
+  return m_mat.values()[i + j*m_mat.stride()];
+}
+
+inline
+TeuchosMatrix::BulkWriter::BulkWriter(TeuchosMatrix& matrix)
+  :
+  m_matrix(matrix)
+{
+}
+
+inline
+TeuchosMatrix::BulkWriter::~BulkWriter()
+{
+  m_matrix.resetLU();
+}
+
+inline double&
+TeuchosMatrix::BulkWriter::operator()(unsigned int i, unsigned int j) const
+{
+#ifdef DEBUG
+  UQ_FATAL_TEST_MACRO((i >= (unsigned int) m_matrix.m_mat.numRows()) || (j >= (unsigned int) m_matrix.m_mat.numCols()),
+                      m_matrix.m_env.worldRank(),
+                      "TeuchosMatrix::BulkWriter::operator()",
+                      "(i,j) is out of bounds");
+#endif
+  return m_matrix.m_mat.values()[i + j*m_matrix.m_mat.stride()];
+}
+
 TeuchosMatrix operator*       (double a,                    const TeuchosMatrix& mat);
 TeuchosVector operator*       (const TeuchosMatrix& mat, const TeuchosVector& vec);
 TeuchosMatrix operator*       (const TeuchosMatrix& m1,  const TeuchosMatrix& m2 );
@@ -180,6 +180,9 @@ public:
   
   //! This function returns true if at least one component of \c this is bigger than or equal to the respective component of rhs. 
   bool         atLeastOneComponentBiggerOrEqualThan (const TeuchosVector& rhs) const;
+
+  //! This function returns true if at least one component of \c this is smaller than the respective component of \c lower or bigger than the respective component of \c upper.
+  bool         atLeastOneComponentOutside           (const TeuchosVector& lower, const TeuchosVector& upper) const;
   //@}
   
     //! @name Set methods.
@@ -126,6 +126,13 @@ public:
         const D_M*                                        m_Wy;                    // Equal to '&experimentStorage.Wy()'
 
         D_M                                               m_Smat_v_asterisk_v_asterisk;
+
+        // Squared distances between pairs of experimental scenarios, stored per scenario dimension
+        // over the strictly upper triangle of pairs: entry [k*n(n-1)/2 + p], with p = 0 for pair (0,1)
+        std::vector<double>                               m_paper_xs_standard_d2;
+
+        // Experimental scenarios laid out contiguously, one row of p_x values per scenario
+        std::vector<double>                               m_paper_xs_standard_flat;
 };
 
 }  // End namespace QUESO
@@ -111,6 +111,10 @@ public:
 
         double                                     m_a_y_modifier;
         double                                     m_b_y_modifier;
+
+        // Squared distances between experimental scenarios x_i and simulation scenarios x^*_j, stored
+        // per scenario dimension over all n x m pairs in row major order: entry [k*n*m + i*m + j]
+        std::vector<double>                        m_paper_xs_xs_asterisks_d2;
 };
 
 }  // End namespace QUESO
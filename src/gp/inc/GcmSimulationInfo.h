@@ -44,6 +44,9 @@ public:
                            const SimulationModel  <S_V,S_M,P_V,P_M,Q_V,Q_M>& simulationModel);
  ~GcmSimulationInfo();
 
+  // Allocates 'm_Smat_w' and 'm_Smat_w_hat', if not yet allocated. The structured solver never does it
+  void formDenseMatrices();
+
   const BaseEnvironment&                            m_env;
   const SimulationStorage<S_V,S_M,P_V,P_M,Q_V,Q_M>& m_simulationStorage;
   const SimulationModel  <S_V,S_M,P_V,P_M,Q_V,Q_M>& m_simulationModel;
@@ -114,8 +117,8 @@ public:
         P_V                                                m_tmp_rho_w_vec;
 	std::vector<Q_M* >                                 m_Rmat_w_is;       // to be deleted on destructor
 	std::vector<Q_M* >                                 m_Smat_w_is;       // to be deleted on destructor
-        Q_M                                                m_Smat_w;  // Computed with 'm_simulationModel'
-        Q_M                                                m_Smat_w_hat;
+        Q_M*                                               m_Smat_w;     // Computed with 'm_simulationModel'; to be deleted on destructor
+        Q_M*                                               m_Smat_w_hat; // to be deleted on destructor
 	std::vector<Q_M* >                                 m_Rmat_w_hat_w_asterisk_is; // to be deleted on destructor
 	std::vector<Q_M* >                                 m_Smat_w_hat_w_asterisk_is; // to be deleted on destructor
         Q_M                                                m_Smat_w_hat_w_asterisk; // Computed with 'm_experimentlModel' and 'm_simulationModel'
@@ -158,6 +161,13 @@ public:
         P_M                                                m_predW_atMLE_unique_w_covMatrix;
         P_M                                                m_predW_atMLE_unique_w_corrMatrix;
 #endif
+
+        // Simulation inputs (x^*,t^*) laid out contiguously, one row of p_x+p_t values per design point.
+        // Squared distances between design points are formed from these rows when needed, so the design
+        // itself takes O(m (p_x+p_t)) memory. The correlation and covariance blocks are still dense:
+        // 'm_Rmat_w_is' and 'm_Smat_w_is' hold 2 p_eta matrices of size m x m, and 'm_Smat_w_hat', when
+        // allocated, is (p_eta m) x (p_eta m), whatever the correlation support.
+        std::vector<double>                                m_paper_xts_asterisks_standard_flat;
 };
 
 }  // End namespace QUESO
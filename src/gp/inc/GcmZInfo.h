@@ -51,6 +51,12 @@ public:
                   const GcmExperimentInfo<S_V,S_M,D_V,D_M,P_V,P_M>&         e);
  ~GcmZInfo();
 
+  // Forces formSigma_z() to form all blocks again, after they were overwritten elsewhere
+  void invalidateBlockInputs();
+
+  // Allocates the dense 'z' x 'z' matrices below, if not yet allocated. The structured solver never does it
+  void formDenseMatrices();
+
   const BaseEnvironment&     m_env;
         unsigned int                m_z_size;
         VectorSpace<D_V,D_M> m_z_space;
@@ -59,10 +65,65 @@ public:
         D_M*                        m_Cmat; // to be deleted on destructor
         unsigned int                m_Cmat_rank;
 
-        D_M                         m_tmp_Smat_z;
-        D_M                         m_tmp_Smat_extra;
-        D_M                         m_tmp_Smat_z_hat;
-        D_M                         m_tmp_Smat_z_hat_inv;
+        D_M*                        m_tmp_Smat_z;         // to be deleted on destructor
+        D_M*                        m_tmp_Smat_extra;     // to be deleted on destructor
+        D_M*                        m_tmp_Smat_z_hat;     // to be deleted on destructor
+        D_M*                        m_tmp_Smat_z_hat_inv; // to be deleted on destructor
+
+        // Inputs each block of '\Sigma_z' was last formed from, for each basis vector. formSigma_z() forms
+        // again only the blocks whose inputs changed, e.g. none of the m x m 'w' blocks when only theta
+        // changes. An empty record means that the block has to be formed.
+        std::vector<std::vector<double> >       m_v_block_inputs;  // lambda_v_i, rho_v_i
+        std::vector<std::vector<double> >       m_u_block_inputs;  // lambda_w_i, lambda_s_i, rho_w_i, theta
+        std::vector<std::vector<double> >       m_w_block_inputs;  // lambda_w_i, lambda_s_i, rho_w_i
+        std::vector<std::vector<double> >       m_uw_block_inputs; // lambda_w_i, rho_w_i, theta
+
+        // Factors of the 'w' blocks D_i of '\Sigma_z_hat', kept by the structured solver together with the
+        // inputs they were computed from ('w' block inputs, then lambda_eta). Dense factors are kept in
+        // 'm_w_hat_chol_is', envelope factors (compact correlation support) in the 'm_w_hat_env_*' members,
+        // and only one of the two is allocated. The dense factors take p_eta.m^2 doubles, the size of the
+        // 'w' diagonal blocks of '\Sigma_z' that the structured solver does not form, and are not allocated
+        // with inducing points either.
+        std::vector<D_M* >                      m_w_hat_chol_is; // to be deleted on destructor
+        std::vector<std::vector<double> >       m_w_hat_chol_inputs;
+        std::vector<std::vector<unsigned int> > m_w_hat_env_perms;
+        std::vector<std::vector<unsigned int> > m_w_hat_env_first_cols;
+        std::vector<std::vector<unsigned int> > m_w_hat_env_row_starts;
+        std::vector<std::vector<double> >       m_w_hat_env_factors;
+
+        // Work buffers of the likelihood evaluation. They are sized on first use and keep their capacity
+        // afterwards, so that steady state likelihood evaluations do not allocate.
+        std::vector<double>                     m_tmp_coefs;       // 4 ln(rho_k) of a correlation fill
+        std::vector<double>                     m_tmp_values;      // correlations of a fill, by pair
+        std::vector<double>                     m_tmp_colLogTerms; // 't' terms of the 'uw' correlations
+        std::vector<double>                     m_tmp_blockInputs;
+        std::vector<double>                     m_tmp_zVu;
+        std::vector<double>                     m_tmp_yMat;
+        std::vector<double>                     m_tmp_yVec;
+        std::vector<double>                     m_tmp_uuTerm;
+        std::vector<double>                     m_tmp_uTerm;
+        std::vector<double>                     m_tmp_deltaInv;    // Woodbury terms, see inducingPointWoodburyTerms()
+        std::vector<double>                     m_tmp_gScaled;
+        std::vector<double>                     m_tmp_pMat;
+        std::vector<double>                     m_tmp_gVec;
+        std::vector<double>                     m_tmp_lowerA;
+        std::vector<double>                     m_tmp_wMat;
+        std::vector<double>                     m_tmp_wVec;
+        std::vector<double>                     m_tmp_tMat;
+        std::vector<double>                     m_tmp_tVec;
+        std::vector<double>                     m_tmp_thMat;
+        std::vector<double>                     m_tmp_thetaValues; // inducing point terms, see formInducingPointFactors()
+        std::vector<double>                     m_tmp_inducingInputs;
+        std::vector<double>                     m_tmp_gradA;       // gradient terms, see lnLikelihoodGradient()
+        std::vector<double>                     m_tmp_gradWvu;
+        std::vector<double>                     m_tmp_gradWuw;
+        std::vector<double>                     m_tmp_gradWww;
+        std::vector<double>                     m_tmp_permVec;
+        std::vector<std::vector<unsigned int> > m_tmp_adjacency;
+        std::vector<double>                     m_tmp_cholDiag;
+        std::vector<double>                     m_tmp_cholYVec;    // forward solve of cholLnDeterminantAndQuadraticForm()
+        std::vector<double>                     m_tmp_newPoint;    // prediction terms, see fillR_asterisk_from_inducing_points()
+        std::vector<double>                     m_tmp_newFactor;
 
 private:
   void commonConstructor();
@@ -43,6 +43,9 @@
 #include <queso/Miscellaneous.h>
 #include <sys/time.h>
 
+// Number of new points conditioned together by the batched prediction routines
+#define UQ_GCM_PREDICTION_CHUNK_SIZE 64
+
 namespace QUESO {
 
 template <class S_V,class S_M,class D_V,class D_M,class P_V,class P_M,class Q_V,class Q_M>
@@ -72,9 +75,7 @@ public:
 
         // This routine calls formSigma_z_hat()
         // This routine might call formSigma_z_tilde_hat() in the future
-        // This routine calls fillR_formula2_for_Sigma_v_hat_v_asterisk()
-        // This routine calls fillR_formula1_for_Sigma_u_hat_u_asterisk()
-        // This routine calls fillR_formula1_for_Sigma_w_hat_u_asterisk()
+        // This routine calls formSigma_z_hat_vu_asterisk()
 	void                             predictVUsAtGridPoint                    (const S_V& newScenarioVec,
                                                                                    const P_V& newParameterVec,
                                                                                          P_V& vuMeanVec,
@@ -85,7 +86,7 @@ public:
                                                                                          P_M& uCovMatrix);
 
         // This routine calls formSigma_w_hat()
-        // This routine calls fillR_formula1_for_Sigma_w_hat_w_asterisk()
+        // This routine calls formSigma_w_hat_w_asterisk()
 	void                             predictWsAtGridPoint                     (const S_V& newScenarioVec,
                                                                                    const P_V& newParameterVec,
                                                                                    const P_V* forcingSampleVecForDebug, // Usually NULL
@@ -100,6 +101,25 @@ public:
                                                                                    const P_V& newParameterVec,
                                                                                          Q_V& simulationOutputMeanVec);
 
+        // Batched versions of predictVUsAtGridPoint() and predictWsAtGridPoint(), for many new points
+        // Each posterior sample is drawn once for all points, and its '\Sigma_z_hat' ('\Sigma_w_hat') is
+        // factored once, with the points solved against it by chunks of UQ_GCM_PREDICTION_CHUNK_SIZE
+        // In predictVUsAtGridPoints() the 'v' and 'u' predictions are the leading 'p_delta' and the
+        // trailing 'p_eta' entries of each 'vu' prediction
+        // This routine calls formSigma_z_hat()
+        // This routine calls formSigma_z_hat_vu_asterisk()
+        void                             predictVUsAtGridPoints                   (const std::vector<const S_V* >& newScenarioVecs,
+                                                                                   const P_V&                      newParameterVec,
+                                                                                         std::vector<P_V* >&       vuMeanVecs,
+                                                                                         std::vector<P_M* >&       vuCovMatrices);
+
+        // This routine calls formSigma_w_hat()
+        // This routine calls formSigma_w_hat_w_asterisk()
+        void                             predictWsAtGridPoints                    (const std::vector<const S_V* >& newScenarioVecs,
+                                                                                   const std::vector<const P_V* >& newParameterVecs,
+                                                                                         std::vector<P_V* >&       wMeanVecs,
+                                                                                         std::vector<P_M* >&       wCovMatrices);
+
   //*******************************************************************************
   // The following routines are in GpmsaComputerModel3.h
   //*******************************************************************************
@@ -108,6 +128,7 @@ public:
   const VectorSpace    <P_V,P_M>& unique_vu_space                          () const;
   const BaseVectorRV   <P_V,P_M>& totalPriorRv                             () const;
   const GenericVectorRV<P_V,P_M>& totalPostRv                              () const;
+  const BaseScalarFunction<P_V,P_M>& likelihoodFunction                     () const; // ln(likelihood) of the total values
 
         void                             print                                    (std::ostream& os) const;
   friend std::ostream& operator<<(std::ostream& os,
@@ -136,6 +157,19 @@ private:
                                                                                          P_M*  hessianMatrix,
                                                                                          P_V*  hessianEffect);
 
+        // This routine is called by likelihoodRoutine(), when 'gradVector' is requested in a configuration it covers
+        // It fills 'gradVector' with the derivatives of ln(likelihood) with respect to 'totalValues', through
+        // d(ln(likelihood))/dp = 0.5 tr((a a^T - \Sigma_z_hat^{-1}) d\Sigma_z_hat/dp), where a = \Sigma_z_hat^{-1} z_hat,
+        // from the factors of '\Sigma_z_hat' left by likelihoodRoutine()
+        void                             lnLikelihoodGradient                     (      P_V&                      gradVector);
+        // Fills 'inv' with (L L^T)^{-1}, from the lower triangle L of 'lowerChol'
+        void                             cholInverse                              (const D_M&                      lowerChol,
+                                                                                         D_M&                      inv) const;
+        // Overwrites the 'm' values of 'vec' with D_i^{-1} vec, through the factor of the 'w' block D_i kept by
+        // structuredLnDeterminantAndQuadraticForm()
+        void                             wBlockSolve                              (      unsigned int              i,
+                                                                                         double*                   vec) const;
+
   //*******************************************************************************
   // The following routines are in GpmsaComputerModel4.h
   //*******************************************************************************
@@ -171,6 +205,92 @@ private:
                                                                                    const P_V&                      input_8thetaVec,
                                                                                          unsigned int              outerCounter);
 
+        // This routine is called by likelihoodRoutine()
+        // 'Smat' must be equal to 'SmatTerm1 + SmatTerm2', and is overwritten by its Cholesky factor
+        // It returns 'false' if the factorization failed, and 'Smat' is then left equal to 'SmatTerm1 + SmatTerm2'
+        bool                             cholLnDeterminantAndQuadraticForm        (      D_M&                      Smat,
+                                                                                   const D_M&                      SmatTerm1,
+                                                                                   const D_M&                      SmatTerm2,
+                                                                                   const D_V&                      zVec,
+                                                                                         double&                   lnDeterminant,
+                                                                                         double&                   quadraticForm) const;
+
+        // These routines are called by predictVUsAtGridPoints() and predictWsAtGridPoints()
+        // 'mat' holds a symmetric positive definite matrix in row major order (only its lower triangle
+        // is read), and is overwritten by its lower Cholesky factor. Its strict upper triangle is used as work space
+        void                             cholLowerRowMajor                        (      std::vector<double>&      mat,
+                                                                                         unsigned int              dim,
+                                                                                         unsigned int              outerCounter) const;
+        // Overwrites the 'dim x numRhs' row major 'rhs' with 'L^{-1} rhs'
+        void                             lowerTriangularSolveRowMajor             (const std::vector<double>&      lowerChol,
+                                                                                         unsigned int              dim,
+                                                                                         unsigned int              numRhs,
+                                                                                         std::vector<double>&      rhs) const;
+        // 'rhs' holds the cross covariances of 'numPoints' points, side by side, and is overwritten
+        void                             accumulateBatchedPredictions             (const std::vector<double>&      lowerChol,
+                                                                                   const std::vector<double>&      zSolved,
+                                                                                   const std::vector<double>&      diagSigma11,
+                                                                                         unsigned int              dim,
+                                                                                         unsigned int              firstPoint,
+                                                                                         unsigned int              numPoints,
+                                                                                         std::vector<double>&      rhs,
+                                                                                         std::vector<double>&      sumMeans,
+                                                                                         std::vector<double>&      sumMeanProducts,
+                                                                                         std::vector<double>&      sumCovs) const;
+        void                             finishBatchedPredictions                 (      unsigned int              numSamples,
+                                                                                   const std::vector<double>&      sumMeans,
+                                                                                   const std::vector<double>&      sumMeanProducts,
+                                                                                   const std::vector<double>&      sumCovs,
+                                                                                         std::vector<P_V* >&       meanVecs,
+                                                                                         std::vector<P_M* >&       covMatrices) const;
+
+        // This routine is called by likelihoodRoutine(), after formSigma_z() has filled only the blocks
+        // It returns 'false' if a factorization fails, so that the full '\Sigma_z_hat' is used instead
+        bool                             structuredLnDeterminantAndQuadraticForm  (      double                    lambdaEta,
+                                                                                         double                    lambdaY,
+                                                                                         double&                   lnDeterminant,
+                                                                                         double&                   quadraticForm);
+
+        // These routines are called by structuredLnDeterminantAndQuadraticForm(), with a compact correlation support
+        // Sorts each list of 'adjacency' by increasing degree, then orders the nodes into 'perm'
+        void                             reverseCuthillMcKee                      (std::vector<std::vector<unsigned int> >& adjacency,
+                                                                                         std::vector<unsigned int>& perm) const;
+        // Returns the envelope size, for the symmetric pattern 'adjacency' permuted by 'perm'
+        unsigned int                     envelopeStructure                        (const std::vector<std::vector<unsigned int> >& adjacency,
+                                                                                   const std::vector<unsigned int>& perm,
+                                                                                         std::vector<unsigned int>& firstCols,
+                                                                                         std::vector<unsigned int>& rowStarts) const;
+        // Factors the envelope in place. Returns 'false' if the permuted matrix is not numerically positive definite
+        bool                             envelopeCholesky                         (const std::vector<unsigned int>& firstCols,
+                                                                                   const std::vector<unsigned int>& rowStarts,
+                                                                                         std::vector<double>&      lowerEnv) const;
+        void                             envelopeForwardSolve                     (const std::vector<unsigned int>& firstCols,
+                                                                                   const std::vector<unsigned int>& rowStarts,
+                                                                                   const std::vector<double>&      lowerEnv,
+                                                                                         double*                   vec) const;
+        // Overwrites 'vec' with L^{-T} vec, for the envelope factor L. This routine is called by wBlockSolve()
+        void                             envelopeBackwardSolve                    (const std::vector<unsigned int>& firstCols,
+                                                                                   const std::vector<unsigned int>& rowStarts,
+                                                                                   const std::vector<double>&      lowerEnv,
+                                                                                         double*                   vec) const;
+        // These routines are called by formSigma_z() and structuredLnDeterminantAndQuadraticForm(), which keep
+        // blocks, and factors, for as long as the inputs they were formed from do not change
+        void                             appendBlockInputs                        (const P_V&                      vec,
+                                                                                         std::vector<double>&      inputs) const;
+        // Returns 'true', and stores 'inputs' into 'record', when they differ from the inputs in 'record'
+        bool                             blockInputsChanged                       (const std::vector<double>&      inputs,
+                                                                                         std::vector<double>&      record) const;
+
+        // This routine is called by structuredLnDeterminantAndQuadraticForm(), with inducing points for '\Sigma_w':
+        // it computes the contributions of basis vector 'i' through the Woodbury identity, in O(m.k^2)
+        // 'uuTerm' (n x n, row major) and 'uTerm' are to be subtracted from the 'u_i' Schur complement and data
+        bool                             inducingPointWoodburyTerms               (      unsigned int              i,
+                                                                                         double                    lambdaEta,
+                                                                                         std::vector<double>&      uuTerm,
+                                                                                         std::vector<double>&      uTerm,
+                                                                                         double&                   lnDeterminant,
+                                                                                         double&                   quadraticForm) const;
+
         // This routine is called by formSigma_z_hat()
         // This routine is called by formSigma_z_tilde_hat()
         // This routine calls fillR_formula2_for_Sigma_v ()
@@ -183,12 +303,33 @@ private:
                                                                                    const P_V&                      input_6lambdaVVec, // ppp: what if there is no experimental data?
                                                                                    const P_V&                      input_7rhoVVec,
                                                                                    const P_V&                      input_8thetaVec,
-                                                                                         unsigned int              outerCounter);
+                                                                                         unsigned int              outerCounter,
+                                                                                         bool                      assembleSigma_z);
         void                             formSigma_z                              (const P_V&                      input_2lambdaWVec, // ppp: does multiple Gs affect this routine?
                                                                                    const P_V&                      input_3rhoWVec,
                                                                                    const P_V&                      input_4lambdaSVec,
                                                                                          unsigned int              outerCounter);
 
+        // This routine is called by predictVUsAtGridPoint() and predictVUsAtGridPoints()
+        // This routine calls fillR_formula2_for_Sigma_v_hat_v_asterisk()
+        // This routine calls fillR_formula1_for_Sigma_u_hat_u_asterisk()
+        // This routine calls fillR_formula1_for_Sigma_w_hat_u_asterisk()
+        void                             formSigma_z_hat_vu_asterisk              (const P_V&                      input_2lambdaWVec,
+                                                                                   const P_V&                      input_3rhoWVec,
+                                                                                   const P_V&                      input_6lambdaVVec,
+                                                                                   const P_V&                      input_7rhoVVec,
+                                                                                   const S_V&                      newScenarioVec,
+                                                                                   const P_V&                      newParameterVec,
+                                                                                         unsigned int              outerCounter);
+
+        // This routine is called by predictWsAtGridPoint() and predictWsAtGridPoints()
+        // This routine calls fillR_formula1_for_Sigma_w_hat_w_asterisk()
+        void                             formSigma_w_hat_w_asterisk               (const P_V&                      input_2lambdaWVec,
+                                                                                   const P_V&                      input_3rhoWVec,
+                                                                                   const S_V&                      newScenarioVec,
+                                                                                   const P_V&                      newParameterVec,
+                                                                                         unsigned int              outerCounter);
+
         // This routine calls fillR_formula1_for_Sigma_w()
         void                             formSigma_w_hat                          (const P_V&                      input_1lambdaEtaVec,
                                                                                    const P_V&                      input_2lambdaWVec,
@@ -225,6 +366,79 @@ private:
                                                                                          D_M&                      Rmat,
                                                                                          unsigned int              outerCounter);
 
+        // This routine is called by the routines above, with the squared distances precomputed for the
+        // fixed designs by GcmExperimentInfo and GcmJointInfo
+        void                             fillR_from_squared_distances             (const std::vector<double>&      d2,
+                                                                                   const P_V&                      rhoVec,
+                                                                                         unsigned int              numDims,
+                                                                                   const double*                   colLogTerms,
+                                                                                         bool                      symmetric,
+                                                                                         D_M&                      Rmat) const;
+
+        // This routine is called by fillR_formula1_for_Sigma_w(): it fills the symmetric correlations
+        // between the rows of 'design', each holding 'designStride' contiguous inputs, with no table of
+        // squared distances
+        void                             fillR_from_flat_design                   (const std::vector<double>&      design,
+                                                                                         unsigned int              designStride,
+                                                                                   const P_V&                      rhoVec,
+                                                                                         D_M&                      Rmat) const;
+
+        // This routine is called by the four '_asterisk' routines below: it fills the 'numRows x 1'
+        // correlations between the rows of 'design', each holding 'designStride' contiguous inputs with the
+        // scenario ones first, and a new point. The parameter inputs are skipped when 'tVec2' is NULL.
+        void                             fillR_asterisk_from_flat_design          (const std::vector<double>&      design,
+                                                                                         unsigned int              designStride,
+                                                                                   const S_V&                      xVec2,
+                                                                                   const P_V*                      tVec2,
+                                                                                   const P_V&                      rhoVec,
+                                                                                         D_M&                      Rmat) const;
+
+        // Wendland correlation replacing 'exp(logCorrelation)', when 'compactCorrelationSupport' is positive
+        double                           compactCorrelation                       (double                          logCorrelation) const;
+        // Derivative of the correlation with respect to 'logCorrelation', either 'exp' or compactCorrelation()
+        double                           correlationDerivative                    (double                          logCorrelation) const;
+
+        // Inducing point approximation of the 'w' correlations, when 'numInducingPoints' is positive:
+        // R(a,b) = c_a^T C^{-1} c_b for a != b, and R(a,a) = 1, where 'C' holds the correlations among the
+        // inducing points and 'c_a' the correlations between point 'a' and the inducing points
+        double                           inducingPointCorrelation                 (const double*                   xValues,
+                                                                                   const double*                   tValues,
+                                                                                         unsigned int              inducingId,
+                                                                                   const P_V&                      rho_w_vec) const;
+        // 'lowerInducing' receives the row major lower Cholesky factor of 'C'
+        void                             formInducingPointCholesky                (const P_V&                      rho_w_vec,
+                                                                                         std::vector<double>&      lowerInducing,
+                                                                                         unsigned int              outerCounter) const;
+        // 'factor' receives the 'k x numPoints' row major matrix L^{-1} [c_1 ... c_numPoints], where the points
+        // are the rows of 'design' (see fillR_asterisk_from_flat_design()). When 'tValues' is not NULL, it
+        // holds the parameter inputs shared by all points, and the rows of 'design' hold scenario inputs only.
+        void                             formInducingPointFactor                  (const std::vector<double>&      design,
+                                                                                         unsigned int              designStride,
+                                                                                   const double*                   tValues,
+                                                                                   const P_V&                      rho_w_vec,
+                                                                                   const std::vector<double>&      lowerInducing,
+                                                                                         std::vector<double>&      factor) const;
+        // This routine is called by formSigma_z(): it fills 'm_inducing_w_factors' and 'm_inducing_u_factors'
+        void                             formInducingPointFactors                 (const P_V&                      input_3rhoWVec,
+                                                                                   const P_V&                      input_8thetaVec,
+                                                                                         unsigned int              outerCounter);
+        // Fills 'm_inducing_lower_factors[i]' and 'm_inducing_w_factors[i]', which only depend on 'rho_w_vec':
+        // they are kept while it does not change, e.g. over all the grid points of a posterior sample
+        void                             formInducingPointWFactor                 (      unsigned int              i,
+                                                                                   const P_V&                      rho_w_vec,
+                                                                                         unsigned int              outerCounter);
+        void                             fillR_from_inducing_point_factors        (const std::vector<double>&      factor1,
+                                                                                   const std::vector<double>&      factor2,
+                                                                                         bool                      symmetric,
+                                                                                         D_M&                      Rmat) const;
+        // Overwrites the 'm x 1' correlations between the simulation design and a new point, for basis vector 'i'
+        void                             fillR_asterisk_from_inducing_points      (      unsigned int              i,
+                                                                                   const S_V&                      xVec,
+                                                                                   const P_V&                      tVec,
+                                                                                   const P_V&                      rho_w_vec,
+                                                                                         D_M&                      Rmat,
+                                                                                         unsigned int              outerCounter);
+
         void                             fillR_formula2_for_Sigma_v_hat_v_asterisk(const std::vector<const S_V* >& xVecs1,
                                                                                    const std::vector<const P_V* >& tVecs1,
                                                                                    const S_V&                      xVec2,
@@ -271,6 +485,18 @@ private:
         bool                                                            m_allOutputsAreScalar;
         bool                                                            m_formCMatrix;
         bool                                                            m_cMatIsRankDefficient;
+        bool                                                            m_useStructuredSigmaZ;
+        D_M*                                                            m_structured_Smat_vu_schur; // to be deleted on destructor
+        D_M*                                                            m_structured_Smat_vu_inv;   // to be deleted on destructor
+        bool                                                            m_structuredSolveSucceeded; // by the last likelihood evaluation
+        bool                                                            m_Smat_z_hat_is_factored;   // by the last likelihood evaluation
+        std::vector<unsigned int>                                       m_inducingPointIds;
+        bool                                                            m_useInducingPointWoodbury;
+        std::vector<std::vector<double> >                               m_inducing_w_factors; // k x m, for each basis vector
+        std::vector<std::vector<double> >                               m_inducing_u_factors; // k x n, for each basis vector
+        std::vector<std::vector<double> >                               m_inducing_lower_factors; // k x k Cholesky factor of 'C', for each basis vector
+        std::vector<std::vector<double> >                               m_inducing_w_inputs;      // rho_w_i
+        std::vector<std::vector<double> >                               m_inducing_u_inputs;      // rho_w_i, theta
         BaseScalarFunction    <P_V,P_M>*                         m_likelihoodFunction;
         unsigned int                                                    m_like_counter;
 
@@ -52,6 +52,9 @@
 #define UQ_GCM_PRED_WS_BY_SAMPLING_RVS_ODV               0
 #define UQ_GCM_PRED_WS_BY_SUMMING_RVS_ODV                1
 #define UQ_GCM_PRED_WS_AT_KEY_POINTS_ODV                 0
+#define UQ_GCM_USE_STRUCTURED_SIGMA_Z_SOLVER_ODV          0
+#define UQ_GCM_COMPACT_CORRELATION_SUPPORT_ODV            0.
+#define UQ_GCM_NUM_INDUCING_POINTS_ODV                    0
 
 namespace QUESO {
 
@@ -83,6 +86,9 @@ public:
   bool                   m_predWsBySamplingRVs;
   bool                   m_predWsBySummingRVs;
   bool                   m_predWsAtKeyPoints;
+  bool                   m_useStructuredSigmaZSolver;
+  double                 m_compactCorrelationSupport;
+  unsigned int           m_numInducingPoints;
 
   //MhOptionsValues m_mhOptionsValues;
 
@@ -140,6 +146,9 @@ private:
   std::string                   m_option_predWsBySamplingRVs;
   std::string                   m_option_predWsBySummingRVs;
   std::string                   m_option_predWsAtKeyPoints;
+  std::string                   m_option_useStructuredSigmaZSolver;
+  std::string                   m_option_compactCorrelationSupport;
+  std::string                   m_option_numInducingPoints;
 };
 
 std::ostream& operator<<(std::ostream& os, const GpmsaComputerModelOptions& obj);
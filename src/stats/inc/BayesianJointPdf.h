@@ -91,6 +91,9 @@ public:
   
   //! Returns the logarithm of the last computed likelihood value.  Access to protected attribute m_lastComputedLogLikelihood.
   double lastComputedLogLikelihood() const;
+
+  //! Returns the exponent of the likelihood function. Access to protected attribute m_likelihoodExponent.
+  double likelihoodExponent       () const;
   
   //@}
 
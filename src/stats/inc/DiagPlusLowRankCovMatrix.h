@@ -0,0 +1,152 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008,2009,2010,2011,2012,2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef UQ_DIAG_PLUS_LOW_RANK_COV_MATRIX_H
+#define UQ_DIAG_PLUS_LOW_RANK_COV_MATRIX_H
+
+#include <queso/Environment.h>
+#include <vector>
+#include <iostream>
+
+namespace QUESO {
+
+//*****************************************************
+// Diagonal plus low rank covariance matrix
+//*****************************************************
+/*!
+ * \class DiagPlusLowRankCovMatrix
+ * \brief A covariance matrix of the form \f$ D + U U^T \f$.
+ *
+ * \f$ D \f$ is a positive diagonal matrix, given as the vector of its entries, and \f$ U \f$ is a
+ * \f$ d \times k \f$ matrix, given as its \f$ k \f$ columns. Only \f$ O(dk) \f$ numbers are stored.
+ * Linear solves use the Woodbury identity
+ * \f[ (D + U U^T)^{-1} = D^{-1} - D^{-1} U C^{-1} U^T D^{-1}, \quad C = I + U^T D^{-1} U, \f]
+ * and the log-determinant uses the matrix determinant lemma
+ * \f[ \ln|D + U U^T| = \ln|D| + \ln|C|, \f]
+ * so the only factorization is the Cholesky factorization of the \f$ k \times k \f$ matrix
+ * \f$ C \f$, computed once at construction. Solves cost \f$ O(dk + k^2) \f$. */
+
+template<class V, class M>
+class DiagPlusLowRankCovMatrix {
+public:
+  //! @name Constructor/Destructor methods
+  //@{
+  //! Constructor.
+  /*! Constructs the covariance matrix \f$ diag(diagVector) + \sum_j u_j u_j^T \f$, where the
+   * \f$ u_j \f$ are the vectors in \c lowRankColumns (which may be empty). All entries of
+   * \c diagVector must be positive.*/
+  DiagPlusLowRankCovMatrix(const V&                       diagVector,
+                           const std::vector<const V*>&   lowRankColumns);
+
+  //! Scaled copy constructor.
+  /*! Constructs \f$ factor \cdot (D + U U^T) \f$, i.e., the diagonal is multiplied by \c factor
+   * and the columns by \f$ \sqrt{factor} \f$. */
+  DiagPlusLowRankCovMatrix(const DiagPlusLowRankCovMatrix<V,M>& rhs,
+                           double                               factor);
+
+  //! Copy constructor.
+  DiagPlusLowRankCovMatrix(const DiagPlusLowRankCovMatrix<V,M>& rhs);
+
+  //! Destructor.
+  ~DiagPlusLowRankCovMatrix();
+  //@}
+
+  //! @name Attribute methods
+  //@{
+  //! Environment.
+  const BaseEnvironment& env           () const;
+
+  //! Dimension \f$ d \f$ of the matrix.
+  unsigned int           dim           () const;
+
+  //! Number \f$ k \f$ of columns of \f$ U \f$.
+  unsigned int           rank          () const;
+
+  //! The diagonal of \f$ D \f$.
+  const V&               diagVector    () const;
+
+  //! The \c j-th column of \f$ U \f$.
+  const V&               lowRankColumn (unsigned int j) const;
+  //@}
+
+  //! @name Mathematical methods
+  //@{
+  //! Returns \f$ (D + U U^T) x \f$.
+  V      multiply      (const V& x) const;
+
+  //! Returns the solution of \f$ (D + U U^T) x = b \f$, using the Woodbury identity.
+  V      invertMultiply(const V& b) const;
+
+  //! Logarithm of the determinant, using the matrix determinant lemma.
+  double lnDeterminant () const;
+
+  //! Maps standard normal draws to a centered sample of this covariance.
+  /*! Returns \f$ D^{1/2} z + U w \f$ in \c sample, where the \f$ d \f$ entries of \f$ z \f$ are
+   * \c iidGaussianVector and the \f$ k \f$ entries of \f$ w \f$ are \c iidLowRankGaussians, all
+   * drawn by the caller. The cost is \f$ O(dk) \f$.*/
+  void   sample        (const V&                   iidGaussianVector,
+                        const std::vector<double>& iidLowRankGaussians,
+                        V&                         sample) const;
+
+  //! Assembles the dense matrix \f$ D + U U^T \f$ into \c mat.
+  /*! Meant for output and small problems only: it costs \f$ O(d^2 k) \f$.*/
+  void   fillDenseMatrix(M& mat) const;
+  //@}
+
+  //! @name I/O methods
+  //@{
+  //! Prints the diagonal and the columns of \f$ U \f$.
+  void   print         (std::ostream& os) const;
+
+  friend std::ostream& operator<<(std::ostream& os,
+      const DiagPlusLowRankCovMatrix<V,M>& obj) {
+    obj.print(os);
+    return os;
+  }
+  //@}
+
+private:
+  //! Disallowed.
+  DiagPlusLowRankCovMatrix<V,M>& operator=(const DiagPlusLowRankCovMatrix<V,M>& rhs);
+
+  //! Computes \f$ D^{-1} \f$, \f$ D^{-1} U \f$ and the Cholesky factor of \f$ C \f$.
+  void   factorize     ();
+
+  //! Overwrites \c y with \f$ C^{-1} y \f$ with the Cholesky factor of \f$ C \f$.
+  void   capacitanceSolve(std::vector<double>& y) const;
+
+  const BaseEnvironment& m_env;
+  V                      m_diagVector;
+  V                      m_sqrtDiagVector;
+  V                      m_invDiagVector;
+  std::vector<V*>        m_columns;
+  std::vector<V*>        m_invDiagColumns;
+  std::vector<double>    m_capacitanceChol; // k x k, row major, lower triangle
+  double                 m_lnDeterminant;
+};
+
+}  // End namespace QUESO
+
+#endif // UQ_DIAG_PLUS_LOW_RANK_COV_MATRIX_H
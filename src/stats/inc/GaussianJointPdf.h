@@ -33,6 +33,8 @@
 #include <queso/Environment.h>
 #include <queso/ScalarFunction.h>
 #include <queso/BoxSubset.h>
+#include <queso/DiagPlusLowRankCovMatrix.h>
+#include <queso/BlockCyclicMatrix.h>
 
 namespace QUESO {
 
@@ -65,6 +67,23 @@ public:
                           const VectorSet<V,M>& domainSet,
                           const V&                     lawExpVector,
                           const M&                     lawCovMatrix);
+  //! Constructor
+  /*! Constructs a new object, given a prefix and the domain of the PDF, a vector of mean
+   * values, \c lawExpVector, and a covariance matrix in diagonal plus low rank form,
+   * \c lawCovMatrix. No dense matrix is formed: lnValue() costs \f$ O(dk) \f$. */
+  GaussianJointPdf(const char*                          prefix,
+                          const VectorSet<V,M>&         domainSet,
+                          const V&                             lawExpVector,
+                          const DiagPlusLowRankCovMatrix<V,M>& lawCovMatrix);
+  //! Constructor
+  /*! Constructs a new object, given a prefix and the domain of the PDF, a vector of mean
+   * values, \c lawExpVector, and a covariance matrix whose rows are distributed over the
+   * processors of the sub-environment, \c lawCovMatrix. Every processor of the sub-environment
+   * must then call lnValue() together. */
+  GaussianJointPdf(const char*                          prefix,
+                          const VectorSet<V,M>&         domainSet,
+                          const V&                             lawExpVector,
+                          const BlockCyclicMatrix&             lawCovMatrix);
   //! Destructor
  ~GaussianJointPdf();
  //@}
@@ -89,13 +108,18 @@ public:
     
   //! Updates the mean with the new value \c newLawExpVector.  
   /*! This method deletes old expected values (allocated at construction or last call to this method).*/
-  void     updateLawExpVector(const V& newLawExpVector);
+  virtual void updateLawExpVector(const V& newLawExpVector);
   
   //! Updates the lower triangular matrix from Cholesky decomposition of the covariance matrix to the new value \c newLowerCholLawCovMatrix.
   /*! This method deletes old expected values (allocated at construction or last call to this method).*/
-  void     updateLawCovMatrix(const M& newLawCovMatrix);
+  virtual void updateLawCovMatrix(const M& newLawCovMatrix);
+
+  //! Updates the covariance matrix to the diagonal plus low rank matrix \c newLawCovMatrix.
+  virtual void updateLawCovMatrix(const DiagPlusLowRankCovMatrix<V,M>& newLawCovMatrix);
   
   //! Returns the covariance matrix; access to protected attribute m_lawCovMatrix.  
+  /*! If the covariance matrix is in diagonal plus low rank form, the dense matrix is assembled
+   * on the first call. A distributed covariance matrix is never assembled: this is then an error.*/
   const M& lawCovMatrix      () const;
 
   //! Access to the vector of mean values and private attribute:  m_lawExpVector. 
@@ -113,7 +137,9 @@ protected:
   V*       m_lawExpVector;
   V*       m_lawVarVector;
   bool     m_diagonalCovMatrix;
-  const M* m_lawCovMatrix;
+  mutable const M* m_lawCovMatrix;
+  DiagPlusLowRankCovMatrix<V,M>* m_lowRankLawCovMatrix;
+  BlockCyclicMatrix*             m_distributedLawCovMatrix;
 };
 
 }  // End namespace QUESO
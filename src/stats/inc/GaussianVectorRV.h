@@ -28,6 +28,7 @@
 #include <queso/VectorRV.h>
 #include <queso/VectorSpace.h>
 #include <queso/JointPdf.h>
+#include <queso/DiagPlusLowRankCovMatrix.h>
 #include <queso/VectorRealizer.h>
 #include <queso/VectorCdf.h>
 #include <queso/VectorMdf.h>
@@ -77,6 +78,26 @@ public:
                           const V&                     lawExpVector,
                           const M&                     lawCovMatrix);
   
+  //! Constructor  
+  /*! Construct a Gaussian vector RV with mean \c lawExpVector and covariance matrix
+   * \c lawCovMatrix whose variates live in \c imageSet. The lower triangular Cholesky factor
+   * \c lowerCholLawCovMatrix of \c lawCovMatrix has already been computed by the caller, so it
+   * is handed directly to the realizer and no factorization is performed here.*/
+  GaussianVectorRV(const char*                  prefix,
+                          const VectorSet<V,M>& imageSet,
+                          const V&                     lawExpVector,
+                          const M&                     lawCovMatrix,
+                          const M&                     lowerCholLawCovMatrix);
+  
+  //! Constructor  
+  /*! Construct a Gaussian vector RV with mean \c lawExpVector and covariance matrix
+   * \c lawCovMatrix, given in diagonal plus low rank form, whose variates live in \c imageSet.
+   * Neither the PDF nor the realizer forms or factorizes a dense matrix.*/
+  GaussianVectorRV(const char*                          prefix,
+                          const VectorSet<V,M>&         imageSet,
+                          const V&                             lawExpVector,
+                          const DiagPlusLowRankCovMatrix<V,M>& lawCovMatrix);
+  
   //! Virtual destructor
   virtual ~GaussianVectorRV();
   //@}
@@ -84,12 +105,16 @@ public:
   //! @name Statistical methods
   //@{
   //! Updates the vector that contains the mean values.
-  void updateLawExpVector(const V& newLawExpVector);
+  virtual void updateLawExpVector(const V& newLawExpVector);
   
   //! Updates the covariance matrix.
   /*! This method tries to use Cholesky decomposition; and if it fails, the method then 
    *  calls a SVD decomposition.*/
-  void updateLawCovMatrix(const M& newLawCovMatrix);
+  virtual void updateLawCovMatrix(const M& newLawCovMatrix);
+
+  //! Updates the covariance matrix to the diagonal plus low rank matrix \c newLawCovMatrix.
+  /*! No factorization of a dense matrix is performed.*/
+  virtual void updateLawCovMatrix(const DiagPlusLowRankCovMatrix<V,M>& newLawCovMatrix);
   //@}
   
   //! @name I/O methods
@@ -98,8 +123,13 @@ public:
   /*! \todo: implement me!*/
   void print(std::ostream& os) const;
  //@}
-  
-private:
+
+protected:
+  //! Constructor for derived classes, which create their own PDF and realizer.
+  /*! \c prefix is used as is.*/
+  GaussianVectorRV(const char*                  prefix,
+                          const VectorSet<V,M>& imageSet);
+
   using BaseVectorRV<V,M>::m_env;
   using BaseVectorRV<V,M>::m_prefix;
   using BaseVectorRV<V,M>::m_imageSet;
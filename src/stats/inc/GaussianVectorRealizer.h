@@ -28,6 +28,8 @@
 #include <queso/VectorRealizer.h>
 #include <queso/VectorSequence.h>
 #include <queso/Environment.h>
+#include <queso/DiagPlusLowRankCovMatrix.h>
+#include <queso/BoxSubset.h>
 #include <math.h>
 
 namespace QUESO {
@@ -39,7 +41,11 @@ namespace QUESO {
  * \class GaussianVectorRealizer
  * \brief A class for handling sampling from Gaussian probability density distributions.
  *
- * This class handles sampling from a Gaussian probability density distribution.*/
+ * This class handles sampling from a Gaussian probability density distribution restricted to its
+ * image set. In general, draws are rejected until one falls inside the image set. When the image
+ * set is a BoxSubset with at least one finite bound and the covariance matrix is diagonal, each component is instead drawn
+ * exactly from its truncated normal law (see TruncatedStdGaussianSample()), so no draw is ever
+ * rejected, however far the mean lies from the box.*/
 
 template<class V, class M>
 class GaussianVectorRealizer : public BaseVectorRealizer<V,M> {
@@ -67,6 +73,16 @@ public:
                                 const M&                     matU,
                                 const V&                     vecSsqrt,
                                 const M&                     matVt);
+
+  //! Constructor
+  /*! Constructs a new object, given a prefix and the image set of the vector realizer, a
+   * vector of mean values, \c lawExpVector, and a covariance matrix in diagonal plus low rank
+   * form, \c lawCovMatrix. Each realization then costs \f$ O(dk) \f$ and no factorization of a
+   * \f$ d \times d \f$ matrix is ever needed.  */
+  GaussianVectorRealizer(const char*                          prefix,
+                                const VectorSet<V,M>&         unifiedImageSet,
+                                const V&                             lawExpVector, // vector of mean values
+                                const DiagPlusLowRankCovMatrix<V,M>& lawCovMatrix);
   //! Destructor
   ~GaussianVectorRealizer();
   //@}
@@ -100,6 +116,11 @@ public:
     void updateLowerCholLawCovMatrix(const M& matU,
            const V& vecSsqrt,
            const M& matVt);
+
+  //! Updates the covariance matrix to the diagonal plus low rank matrix \c newLawCovMatrix.
+  /*! This routine deletes old expected values: m_lowerCholLawCovMatrix; m_matU, m_vecSsqrt,
+   *  m_matVt; m_lowRankLawCovMatrix. */
+  void updateLawCovMatrix(const DiagPlusLowRankCovMatrix<V,M>& newLawCovMatrix);
   //@}
   
 private:
@@ -109,6 +130,16 @@ private:
   M* m_matU;
   V* m_vecSsqrt;
   M* m_matVt;
+  DiagPlusLowRankCovMatrix<V,M>* m_lowRankLawCovMatrix;
+  const BoxSubset<V,M>* m_imageBox;            // NULL unless the image set is a box with a finite bound
+  bool                  m_diagonalLowerChol;   // m_lowerCholLawCovMatrix is diagonal
+  mutable std::vector<double> m_lowRankGaussians; // work space of realization() with m_lowRankLawCovMatrix
+
+  //! Sets m_imageBox from the image set.
+  void setImageBox();
+
+  //! Sets m_diagonalLowerChol from m_lowerCholLawCovMatrix.
+  void checkDiagonalLowerChol();
 
   using BaseVectorRealizer<V,M>::m_env;
   using BaseVectorRealizer<V,M>::m_prefix;
@@ -392,10 +392,11 @@ private:
                                         const std::vector<unsigned int>&                unifiedIndexCountersAtProc0Only,    // input
                                         UnbalancedLinkedChainsPerNodeStruct&          unbalancedLinkControl);             // output
 
-   /*! @param[in] inputOptions, unifiedCovMatrix, rv, balancedLinkControl, 
+   /*! @param[in] inputOptions, unifiedCovMatrix, unifiedLowerCholCovMatrix, rv, balancedLinkControl, 
     *  @param[out] workingChain, cumulativeRunTime, cumulativeRejections, currLogLikelihoodValues, currLogTargetValues*/
    void   generateBalLinkedChains_all   (MLSamplingLevelOptions&                  inputOptions,                       // input, only m_rawChainSize changes
                                         const P_M&                                      unifiedCovMatrix,                   // input
+                                        const P_M*                                      unifiedLowerCholCovMatrix,          // input
                                         const GenericVectorRV  <P_V,P_M>&        rv,                                 // input
                                         const BalancedLinkedChainsPerNodeStruct<P_V>& balancedLinkControl,                // input // Round Rock
                                         SequenceOfVectors      <P_V,P_M>&        workingChain,                       // output
@@ -404,10 +405,11 @@ private:
                                         ScalarSequence         <double>*         currLogLikelihoodValues,            // output
                                         ScalarSequence         <double>*         currLogTargetValues);               // output
 
-    /*! @param[in] inputOptions, unifiedCovMatrix, rv, unbalancedLinkControl, indexOfFirstWeight, prevChain
+    /*! @param[in] inputOptions, unifiedCovMatrix, unifiedLowerCholCovMatrix, rv, unbalancedLinkControl, indexOfFirstWeight, prevChain
      *  @param[out] workingChain, cumulativeRunTime, cumulativeRejections, currLogLikelihoodValues, currLogTargetValues*/
     void   generateUnbLinkedChains_all   (MLSamplingLevelOptions&                  inputOptions,                       // input, only m_rawChainSize changes
                                         const P_M&                                      unifiedCovMatrix,                   // input
+                                        const P_M*                                      unifiedLowerCholCovMatrix,          // input
                                         const GenericVectorRV  <P_V,P_M>&        rv,                                 // input
                                         const UnbalancedLinkedChainsPerNodeStruct&    unbalancedLinkControl,              // input // Round Rock
                                         unsigned int                                    indexOfFirstWeight,                 // input // Round Rock
@@ -418,6 +420,22 @@ private:
                                         ScalarSequence         <double>*         currLogLikelihoodValues,            // output
                                         ScalarSequence         <double>*         currLogTargetValues);               // output
 
+    /*! Generates the linked chains of a single processor subenvironment concurrently, in
+     *  m_linkedChainsNumThreads OpenMP threads, each chain with its own RNG stream.
+     *  @param[in] inputOptions, unifiedCovMatrix, unifiedLowerCholCovMatrix, rv, initialPositions, chainSizes
+     *  @param[out] workingChain, cumulativeRunTime, cumulativeRejections, currLogLikelihoodValues, currLogTargetValues*/
+    void   generateThreadedLinkedChains_inter0(MLSamplingLevelOptions&          inputOptions,                       // input, only m_rawChainSize and m_dataOutputFileName change
+                                        const P_M&                                      unifiedCovMatrix,                   // input
+                                        const P_M*                                      unifiedLowerCholCovMatrix,          // input
+                                        const GenericVectorRV  <P_V,P_M>&        rv,                                 // input
+                                        const std::vector<const P_V*>&                  initialPositions,                   // input
+                                        const std::vector<unsigned int>&                chainSizes,                         // input
+                                        SequenceOfVectors      <P_V,P_M>&        workingChain,                       // output
+                                        double&                                         cumulativeRunTime,                  // output
+                                        unsigned int&                                   cumulativeRejections,               // output
+                                        ScalarSequence         <double>*         currLogLikelihoodValues,            // output
+                                        ScalarSequence         <double>*         currLogTargetValues);               // output
+
 #ifdef QUESO_HAS_GLPK
   /*! @param[in] exchangeStdVec
    *  @param[out] exchangeStdVec*/ 
@@ -468,6 +486,9 @@ private:
   
    //! Exponent for debugging.
    double                              m_debugExponent;
+
+   //! Number of calls to generateThreadedLinkedChains_inter0(): part of the RNG stream identifiers.
+   unsigned int                        m_numThreadedLinkedChainsCalls;
 	std::vector<double>                 m_logEvidenceFactors; // restart
         double                              m_logEvidence;
         double                              m_meanLogLikelihood;
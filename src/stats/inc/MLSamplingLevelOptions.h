@@ -42,6 +42,7 @@
 #define UQ_ML_SAMPLING_L_DATA_OUTPUT_ALLOWED_SET_ODV                          ""
 #define UQ_ML_SAMPLING_L_LOAD_BALANCE_ALGORITHM_ID_ODV                        2
 #define UQ_ML_SAMPLING_L_LOAD_BALANCE_TRESHOLD_ODV                            1.
+#define UQ_ML_SAMPLING_L_LINKED_CHAINS_NUM_THREADS_ODV                        1
 #define UQ_ML_SAMPLING_L_MIN_EFFECTIVE_SIZE_RATIO_ODV                         0.85
 #define UQ_ML_SAMPLING_L_MAX_EFFECTIVE_SIZE_RATIO_ODV                         0.91
 #define UQ_ML_SAMPLING_L_SCALE_COV_MATRIX_ODV                                 1
@@ -84,6 +85,7 @@
 #define UQ_ML_SAMPLING_L_PUT_OUT_OF_BOUNDS_IN_CHAIN_ODV                       1
 #define UQ_ML_SAMPLING_L_TK_USE_LOCAL_HESSIAN_ODV                             0
 #define UQ_ML_SAMPLING_L_TK_USE_NEWTON_COMPONENT_ODV                          1
+#define UQ_ML_SAMPLING_L_TK_TRUNCATE_TO_BOX_ODV                               0
 #define UQ_ML_SAMPLING_L_DR_MAX_NUM_EXTRA_STAGES_ODV                          0
 #define UQ_ML_SAMPLING_L_DR_LIST_OF_SCALES_FOR_EXTRA_STAGES_ODV               "1."
 #define UQ_ML_SAMPLING_L_DR_DURING_AM_NON_ADAPTIVE_INT_ODV                    1
@@ -167,6 +169,12 @@ public:
   
   //! Perform load balancing if load unbalancing ratio > threshold.
   double                             m_loadBalanceTreshold;
+
+  //! Number of OpenMP threads generating the linked chains of each subenvironment (1 = serial).
+  /*! Only used when QUESO is configured with OpenMP and the subenvironment has a single processor.
+   * The likelihood function must then be safe to evaluate concurrently: likelihoods declared non
+   * reentrant with BaseScalarFunction::setReentrant(false) make the chains run serially. */
+  unsigned int                       m_linkedChainsNumThreads;
   
   //! Minimum allowed effective size ratio wrt previous level.
   double                             m_minEffectiveSizeRatio;
@@ -291,6 +299,9 @@ public:
   
   //! Whether or not 'proposal' uses Newton component.
   bool                               m_tkUseNewtonComponent;
+
+  //! Whether or not 'proposal' is truncated to the box domain of the target.
+  bool                               m_tkTruncateToBox;
   
   //! 'dr' maximum number of extra stages.
   unsigned int                       m_drMaxNumExtraStages;
@@ -360,6 +371,7 @@ private:
   std::string                   m_option_dataOutputAllowedSet;
   std::string                   m_option_loadBalanceAlgorithmId;
   std::string                   m_option_loadBalanceTreshold;
+  std::string                   m_option_linkedChainsNumThreads;
   std::string                   m_option_minEffectiveSizeRatio;
   std::string                   m_option_maxEffectiveSizeRatio;
   std::string                   m_option_scaleCovMatrix;
@@ -404,6 +416,7 @@ private:
   std::string                   m_option_putOutOfBoundsInChain;
   std::string                   m_option_tk_useLocalHessian;
   std::string                   m_option_tk_useNewtonComponent;
+  std::string                   m_option_tk_truncateToBox;
   std::string                   m_option_dr_maxNumExtraStages;
   std::string                   m_option_dr_listOfScalesForExtraStages;
   std::string                   m_option_dr_duringAmNonAdaptiveInt;
@@ -27,6 +27,7 @@
 
 #include <queso/MetropolisHastingsSGOptions.h>
 #include <queso/TKGroup.h>
+#include <queso/DiagPlusLowRankCovMatrix.h>
 #include <queso/VectorRV.h>
 #include <queso/VectorSpace.h>
 #include <queso/MarkovChainPositionData.h>
@@ -138,10 +139,25 @@ public:
                               const P_M*                          inputProposalCovMatrix);
 
   //! Constructor.
+  /*! If 'inputProposalLowerCholMatrix' is not NULL, it must be the lower triangular Cholesky factor
+   * of 'inputProposalCovMatrix'; it is then handed to the transition kernel, which skips its own
+   * factorization.*/
   MetropolisHastingsSG(const MLSamplingLevelOptions& mlOptions,
                               const BaseVectorRV<P_V,P_M>&  sourceRv,
                               const P_V&                           initialPosition,
-                              const P_M*                           inputProposalCovMatrix);
+                              const P_M*                           inputProposalCovMatrix,
+                              const P_M*                           inputProposalLowerCholMatrix = NULL);
+
+  //! Constructor.
+  /*! Same as the first constructor, but the proposal covariance matrix 'inputProposalCovMatrix' is
+   * given in diagonal plus low rank form. The transition kernel then never forms or factorizes a
+   * dense matrix and, if adaptive Metropolis is on, the adapted proposal covariance matrices keep
+   * the diagonal plus low rank form as well (see updateAdaptedLowRankCovMatrix()).*/
+  MetropolisHastingsSG(const char*                                 prefix,
+                              const MhOptionsValues*               alternativeOptionsValues,
+                              const BaseVectorRV<P_V,P_M>&         sourceRv,
+                              const P_V&                                  initialPosition,
+                              const DiagPlusLowRankCovMatrix<P_V,P_M>&    inputProposalCovMatrix);
 
   //! Destructor
   ~MetropolisHastingsSG();
@@ -227,6 +243,20 @@ private:
                                    P_V&                                       lastMean,
                                    P_M&                                       lastAdaptedCovMatrix);
 
+  //! This method updates the adapted proposal when it is in diagonal plus low rank form.
+  /*! Only the mean and the variances of the chain are updated recursively, with the same recursion
+   * as updateAdaptedCovMatrix(). The new proposal covariance matrix handed to the transition kernel is
+   * \f$ \eta (D + W W^T) \f$, where the \f$ k \f$ columns of \f$ W \f$ are evenly spaced positions of
+   * \c subChain minus the mean, divided by \f$ \sqrt{k} \f$, and \f$ D \f$ is \f$ \epsilon \f$ plus the
+   * part of the variances not already explained by \f$ W W^T \f$. The rank \f$ k \f$ is the size of
+   * \c subChain, capped by the option 'am_lowRankMaxRank' (0, the default, caps it at \f$ \min(d,10) \f$).
+   * The cost is \f$ O(dk^2) \f$.*/
+  void   updateAdaptedLowRankCovMatrix(const BaseVectorSequence<P_V,P_M>&  subChain,
+                                       unsigned int                               idOfFirstPositionInSubChain,
+                                       double&                                    lastChainSize,
+                                       P_V&                                       lastMean,
+                                       P_V&                                       lastAdaptedVarVector);
+
   //! Calculates acceptance ration.
   /*! It is called by alpha(const std::vector<MarkovChainPositionData<P_V>*>& inputPositions,
       const std::vector<unsigned int>& inputTKStageIds); */
@@ -255,8 +285,10 @@ private:
   const VectorSpace <P_V,P_M>&               m_vectorSpace;
   const BaseJointPdf<P_V,P_M>&               m_targetPdf;
         P_V                                         m_initialPosition;
-        P_M                                         m_initialProposalCovMatrix;
+        P_M*                                        m_initialProposalCovMatrix;
         bool                                        m_nullInputProposalCovMatrix;
+        P_M*                                        m_initialProposalLowerCholMatrix;
+        DiagPlusLowRankCovMatrix<P_V,P_M>*          m_initialProposalLowRankCovMatrix;
         unsigned int                                m_numDisabledParameters; // gpmsa2
         std::vector<bool>                           m_parameterEnabledStatus; // gpmsa2
   const ScalarFunctionSynchronizer<P_V,P_M>* m_targetPdfSynchronizer;
@@ -270,6 +302,8 @@ private:
         double                                      m_lastChainSize;
         P_V*                                        m_lastMean;
         P_M*                                        m_lastAdaptedCovMatrix;
+        P_V*                                        m_lastAdaptedVarVector;
+        DiagPlusLowRankCovMatrix<P_V,P_M>*          m_lastAdaptedLowRankCovMatrix;
         unsigned int                                m_numPositionsNotSubWritten;
 
         MHRawChainInfoStruct                      m_rawChainInfo;
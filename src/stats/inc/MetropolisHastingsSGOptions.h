@@ -73,6 +73,7 @@
 #define UQ_MH_SG_PUT_OUT_OF_BOUNDS_IN_CHAIN_ODV                       1
 #define UQ_MH_SG_TK_USE_LOCAL_HESSIAN_ODV                             0
 #define UQ_MH_SG_TK_USE_NEWTON_COMPONENT_ODV                          1
+#define UQ_MH_SG_TK_TRUNCATE_TO_BOX_ODV                               0
 #define UQ_MH_SG_DR_MAX_NUM_EXTRA_STAGES_ODV                          0
 #define UQ_MH_SG_DR_LIST_OF_SCALES_FOR_EXTRA_STAGES_ODV               ""
 #define UQ_MH_SG_DR_DURING_AM_NON_ADAPTIVE_INT_ODV                    1
@@ -86,6 +87,7 @@
 #define UQ_MH_SG_AM_ADAPTED_MATRICES_DATA_OUTPUT_ALLOWED_SET_ODV      ""
 #define UQ_MH_SG_AM_ETA_ODV                                           1.
 #define UQ_MH_SG_AM_EPSILON_ODV                                       1.e-5
+#define UQ_MH_SG_AM_LOW_RANK_MAX_RANK_ODV                             0 // 0: min(dimension of the parameter space,10)
 #define UQ_MH_SG_ENABLE_BROOKS_GELMAN_CONV_MONITOR                    0
 #define UQ_MH_SG_BROOKS_GELMAN_LAG                                    100
 
@@ -172,6 +174,7 @@ public:
   bool                               m_putOutOfBoundsInChain;
   bool                               m_tkUseLocalHessian;
   bool                               m_tkUseNewtonComponent;
+  bool                               m_tkTruncateToBox;
   unsigned int                       m_drMaxNumExtraStages;
   std::vector<double>                m_drScalesForExtraStages;
   bool                               m_drDuringAmNonAdaptiveInt;
@@ -185,6 +188,7 @@ public:
   std::set<unsigned int>             m_amAdaptedMatricesDataOutputAllowedSet;
   double                             m_amEta;
   double                             m_amEpsilon;
+  unsigned int                       m_amLowRankMaxRank;
 
   unsigned int                       m_enableBrooksGelmanConvMonitor;
   unsigned int                       m_BrooksGelmanLag;
@@ -301,6 +305,7 @@ private:
   std::string                   m_option_putOutOfBoundsInChain;
   std::string                   m_option_tk_useLocalHessian;
   std::string                   m_option_tk_useNewtonComponent;
+  std::string                   m_option_tk_truncateToBox;
   std::string                   m_option_dr_maxNumExtraStages;
   std::string                   m_option_dr_listOfScalesForExtraStages;
   std::string                   m_option_dr_duringAmNonAdaptiveInt;
@@ -314,6 +319,7 @@ private:
   std::string                   m_option_am_adaptedMatrices_dataOutputAllowedSet;
   std::string                   m_option_am_eta;
   std::string                   m_option_am_epsilon;
+  std::string                   m_option_am_lowRankMaxRank;
 
   std::string                   m_option_enableBrooksGelmanConvMonitor;
   std::string                   m_option_BrooksGelmanLag;
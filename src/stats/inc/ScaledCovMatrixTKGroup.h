@@ -28,6 +28,8 @@
 #include <queso/TKGroup.h>
 #include <queso/VectorRV.h>
 #include <queso/ScalarFunctionSynchronizer.h>
+#include <queso/DiagPlusLowRankCovMatrix.h>
+#include <queso/TruncatedGaussianVectorRV.h>
 
 namespace QUESO {
 
@@ -47,14 +49,32 @@ public:
                                 const VectorSpace<V,M>& vectorSpace,
                                 const std::vector<double>&     scales,
                                 const M&                       covMatrix);
+
+  //! Constructor with a precomputed factor.
+  /*! Same as the default constructor, but \c lowerCholCovMatrix is the lower triangular Cholesky
+   * factor of \c covMatrix, already computed by the caller. The factor of each scaled covariance
+   * matrix \f$ C/s^2 \f$ is then simply \f$ L/s \f$, so no factorization is performed.*/
+  ScaledCovMatrixTKGroup(const char*                    prefix,
+                                const VectorSpace<V,M>& vectorSpace,
+                                const std::vector<double>&     scales,
+                                const M&                       covMatrix,
+                                const M&                       lowerCholCovMatrix);
+
+  //! Constructor with a diagonal plus low rank covariance matrix.
+  /*! The scaled covariance matrices \f$ C/s^2 \f$ keep the diagonal plus low rank form, so no
+   * dense matrix is formed or factorized for any scale.*/
+  ScaledCovMatrixTKGroup(const char*                          prefix,
+                                const VectorSpace<V,M>&       vectorSpace,
+                                const std::vector<double>&           scales,
+                                const DiagPlusLowRankCovMatrix<V,M>& covMatrix);
   //! Destructor.
   ~ScaledCovMatrixTKGroup();
   //@}
   
   //! @name Statistical/Mathematical methods
   //@{
-  //! Whether or not the matrix is symmetric. Always 'true'.
-  /*! \todo: It only returns 'true', thus a test for its symmetricity must be included.*/
+  //! Whether or not the matrix is symmetric.
+  /*! 'true' unless the proposals are truncated to a box, see truncateToBox().*/
   bool                          symmetric                 () const;
   
   //! Gaussian increment property to construct a transition kernel.
@@ -66,6 +86,19 @@ public:
   //! Scales the covariance matrix.
   /*! The covariance matrix is scaled by a factor of \f$ 1/scales^2 \f$.*/
   void                          updateLawCovMatrix        (const M& covMatrix);
+
+  //! Scales the diagonal plus low rank covariance matrix.
+  /*! The covariance matrix is scaled by a factor of \f$ 1/scales^2 \f$.*/
+  void                          updateLawCovMatrix        (const DiagPlusLowRankCovMatrix<V,M>& covMatrix);
+
+  //! Truncates the Gaussian proposals to \c box.
+  /*! The RVs are replaced by TruncatedGaussianVectorRVs, so every candidate lies inside \c box,
+   * which should be the domain of the target PDF. The proposal is then no longer symmetric: the
+   * proposal density at \c y given \c x is divided by the Gaussian probability of \c box for
+   * the mean \c x, and the Metropolis-Hastings ratio must account for it. Diagonal covariance
+   * matrices are passed to the RVs as variances, which gives exact sampling and a closed form
+   * box probability. Not available with a diagonal plus low rank covariance matrix.*/
+  void                          truncateToBox             (const BoxSubset<V,M>& box);
   //@}
   
   //! @name Misc methods
@@ -85,7 +118,13 @@ public:
   //@}
 private:
   //! Sets the mean of the RVs to zero.
-  void                          setRVsWithZeroMean        ();
+  /*! If \c lowerCholCovMatrix is NULL, the Cholesky factor of the original covariance matrix is
+   * computed once here and shared by all scales. A diagonal plus low rank original covariance
+   * matrix is simply scaled.*/
+  void                          setRVsWithZeroMean        (const M* lowerCholCovMatrix);
+
+  //! Replaces \c m_rvs[i] by a truncated Gaussian RV with zero mean and covariance matrix \c covMatrix (variances if it is diagonal).
+  void                          setTruncatedRV            (unsigned int i, const M& covMatrix);
   using BaseTKGroup<V,M>::m_env;
   using BaseTKGroup<V,M>::m_prefix;
   using BaseTKGroup<V,M>::m_vectorSpace;
@@ -93,7 +132,9 @@ private:
   using BaseTKGroup<V,M>::m_preComputingPositions;
   using BaseTKGroup<V,M>::m_rvs;
 
-  M m_originalCovMatrix;
+  M*                             m_originalCovMatrix;
+  DiagPlusLowRankCovMatrix<V,M>* m_originalLowRankCovMatrix;
+  const BoxSubset<V,M>*          m_truncationBox;
 };
 
 }  // End namespace QUESO
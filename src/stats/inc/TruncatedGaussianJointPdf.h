@@ -0,0 +1,136 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008,2009,2010,2011,2012,2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef UQ_TRUNCATED_GAUSSIAN_JOINT_PROB_DENSITY_H
+#define UQ_TRUNCATED_GAUSSIAN_JOINT_PROB_DENSITY_H
+
+#include <queso/GaussianJointPdf.h>
+
+namespace QUESO {
+
+//*****************************************************
+// Truncated Gaussian probability density class [PDF-12]
+//*****************************************************
+/*! 
+ * \class TruncatedGaussianJointPdf
+ * \brief A class for handling Gaussian joint PDFs truncated to a box.
+ *
+ * This class allows the mathematical definition of a Gaussian Joint PDF restricted to its domain,
+ * which must be a BoxSubset (infinite bounds are allowed). Outside the box the PDF is zero. Inside
+ * it, the PDF is the Gaussian one divided by the Gaussian probability of the box. With a diagonal
+ * covariance matrix that probability is a product of one dimensional terms, computed exactly:
+ * \f[ P(box) = \prod_i \left[ \Phi\left(\frac{b_i - \mu_i}{\sigma_i}\right) - \Phi\left(\frac{a_i - \mu_i}{\sigma_i}\right) \right]. \f]
+ * With a full covariance matrix there is no closed form. The probability is then estimated with
+ * Genz's separation of variables method, which turns it into the mean of a smooth function over
+ * the unit cube, evaluated on a fixed Richtmyer lattice of setNumBoxProbabilityPoints() points.
+ * The estimate is deterministic, so the PDF is a smooth function of the mean and the covariance
+ * matrix. Each estimate costs \f$ O(N d^2) \f$ for \f$ N \f$ points in dimension \f$ d \f$. The
+ * Cholesky factor and the lattice are computed once per covariance matrix. The estimates of the
+ * current and of the previous mean are both kept, so a Metropolis-Hastings step, which moves the
+ * mean back and forth between the current position and the candidate, pays for one estimate per
+ * new mean. The relative error decreases roughly like \f$ 1/N \f$ and is well below one percent
+ * with the default \f$ N = 1000 \f$ in moderate dimensions.*/
+
+template<class V, class M>
+class TruncatedGaussianJointPdf : public GaussianJointPdf<V,M> {
+public:
+  //! @name Constructor/Destructor methods
+  //@{
+  //! Constructor 
+  /*! Constructs a new object, given a prefix and the box domain of the PDF, a vector of mean
+   * values, \c lawExpVector, and a vector of covariance values \c lawVarVector (an alternative
+   * representation for a diagonal covariance matrix).  */ 
+  TruncatedGaussianJointPdf(const char*                  prefix,
+                            const VectorSet<V,M>&        domainSet,
+                            const V&                     lawExpVector,
+                            const V&                     lawVarVector);
+  //! Constructor
+  /*! Constructs a new object, given a prefix and the box domain of the PDF, a vector of mean
+   * values, \c lawExpVector, and a covariance matrix, \c lawCovMatrix. */ 
+  TruncatedGaussianJointPdf(const char*                  prefix,
+                            const VectorSet<V,M>&        domainSet,
+                            const V&                     lawExpVector,
+                            const M&                     lawCovMatrix);
+  //! Destructor
+ ~TruncatedGaussianJointPdf();
+ //@}
+  
+  //! @name Math methods
+  //@{
+  //! Logarithm of the value of the truncated Gaussian PDF (scalar function).
+  /*! Equal to GaussianJointPdf::lnValue() minus, with the default normalization style, the
+   * logarithm of the Gaussian probability of the box.*/
+  double   lnValue           (const V& domainVector, const V* domainDirection, V* gradVector, M* hessianMatrix, V* hessianEffect) const;
+
+  //! Updates the mean with the new value \c newLawExpVector.
+  void     updateLawExpVector(const V& newLawExpVector);
+
+  //! Updates the covariance matrix to the new value \c newLawCovMatrix.
+  void     updateLawCovMatrix(const M& newLawCovMatrix);
+
+  //! Not supported: the box probability needs the dense covariance matrix.
+  void     updateLawCovMatrix(const DiagPlusLowRankCovMatrix<V,M>& newLawCovMatrix);
+
+  //! Logarithm of the Gaussian probability of the box domain.
+  /*! Exact with a diagonal covariance matrix, estimated as described in the class documentation
+   * otherwise.*/
+  double   lnBoxProbability  () const;
+
+  //! Sets the number of lattice points used to estimate the box probability (full covariance matrix only). Default: 1000.
+  void     setNumBoxProbabilityPoints(unsigned int numPoints);
+  //@}
+protected:
+  using GaussianJointPdf<V,M>::m_env;
+  using GaussianJointPdf<V,M>::m_prefix;
+  using GaussianJointPdf<V,M>::m_domainSet;
+  using GaussianJointPdf<V,M>::m_normalizationStyle;
+  using GaussianJointPdf<V,M>::m_diagonalCovMatrix;
+
+  //! The domain, as a box.
+  const BoxSubset<V,M>* m_domainBox;
+
+  //! Number of lattice points of the box probability estimate.
+  unsigned int          m_numBoxProbabilityPoints;
+
+  //! Lower Cholesky factor of the covariance matrix (full covariance matrix only), computed on demand.
+  mutable M*            m_lowerCholLawCovMatrix;
+
+  //! Cached logarithm of the box probability, valid if m_lnBoxProbabilityIsValid.
+  mutable double        m_lnBoxProbability;
+  mutable bool          m_lnBoxProbabilityIsValid;
+
+  //! Previous mean and logarithm of its box probability (full covariance matrix only), valid if m_prevLnBoxProbabilityIsValid.
+  V*                    m_prevLawExpVector;
+  double                m_prevLnBoxProbability;
+  bool                  m_prevLnBoxProbabilityIsValid;
+
+  //! Steps of the Richtmyer lattice, and work buffers of the box probability estimate.
+  mutable std::vector<double> m_latticeSteps;
+  mutable std::vector<double> m_latticeLnMasses;
+  mutable std::vector<double> m_latticeY;
+};
+
+}  // End namespace QUESO
+
+#endif // UQ_TRUNCATED_GAUSSIAN_JOINT_PROB_DENSITY_H
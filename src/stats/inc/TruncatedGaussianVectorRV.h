@@ -0,0 +1,109 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008,2009,2010,2011,2012,2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef UQ_TRUNCATED_GAUSSIAN_VECTOR_RV_H
+#define UQ_TRUNCATED_GAUSSIAN_VECTOR_RV_H
+
+#include <queso/VectorRV.h>
+#include <queso/GaussianVectorRV.h>
+#include <queso/VectorSpace.h>
+#include <queso/JointPdf.h>
+#include <queso/VectorRealizer.h>
+#include <queso/VectorCdf.h>
+#include <queso/VectorMdf.h>
+#include <queso/SequenceOfVectors.h>
+
+namespace QUESO {
+
+//*****************************************************
+// Truncated Gaussian class [RV-12]
+//*****************************************************
+/*!
+ * \class TruncatedGaussianVectorRV
+ * \brief A class representing a vector RV constructed via Gaussian distribution truncated to a box.
+ * 
+ * This class allows the user to compute the value of a Gaussian PDF restricted to a BoxSubset,
+ * normalized on the box, and to generate exact realizations (samples) from it, see
+ * TruncatedGaussianJointPdf and TruncatedGaussianVectorRealizer. It derives from
+ * GaussianVectorRV, so it can replace the proposal RVs of a transition kernel: the
+ * Metropolis-Hastings option 'tk_truncateToBox' makes ScaledCovMatrixTKGroup propose from it.*/
+
+template<class V, class M>
+class TruncatedGaussianVectorRV : public GaussianVectorRV<V,M> {
+public:
+  //! @name Constructor/Destructor methods
+  //@{
+  //! Constructor  
+  /*! Construct a truncated Gaussian vector RV with mean \c lawExpVector and diagonal covariance
+   * matrix \c lawVarVector whose variates live in the box \c imageSet.*/
+  TruncatedGaussianVectorRV(const char*                  prefix,
+                            const VectorSet<V,M>&        imageSet,
+                            const V&                     lawExpVector,
+                            const V&                     lawVarVector);
+  
+  //! Constructor  
+  /*! Construct a truncated Gaussian vector RV with mean \c lawExpVector and covariance matrix
+   * \c lawCovMatrix whose variates live in the box \c imageSet.*/
+  TruncatedGaussianVectorRV(const char*                  prefix,
+                            const VectorSet<V,M>&        imageSet,
+                            const V&                     lawExpVector,
+                            const M&                     lawCovMatrix);
+  
+  //! Virtual destructor
+  virtual ~TruncatedGaussianVectorRV();
+  //@}
+
+  //! @name Statistical methods
+  //@{
+  //! Updates the vector that contains the mean values.
+  void updateLawExpVector(const V& newLawExpVector);
+  
+  //! Updates the covariance matrix (full covariance matrix only).
+  void updateLawCovMatrix(const M& newLawCovMatrix);
+
+  //! Not supported: diagonal plus low rank covariance matrices cannot be truncated.
+  void updateLawCovMatrix(const DiagPlusLowRankCovMatrix<V,M>& newLawCovMatrix);
+  //@}
+  
+  //! @name I/O methods
+  //@{
+  //! TODO: Prints the vector RV.
+  /*! \todo: implement me!*/
+  void print(std::ostream& os) const;
+ //@}
+  
+private:
+  using GaussianVectorRV<V,M>::m_env;
+  using GaussianVectorRV<V,M>::m_prefix;
+  using GaussianVectorRV<V,M>::m_imageSet;
+  using GaussianVectorRV<V,M>::m_pdf;
+  using GaussianVectorRV<V,M>::m_realizer;
+  using GaussianVectorRV<V,M>::m_subCdf;
+  using GaussianVectorRV<V,M>::m_unifiedCdf;
+  using GaussianVectorRV<V,M>::m_mdf;
+};
+
+}  // End namespace QUESO
+
+#endif // UQ_TRUNCATED_GAUSSIAN_VECTOR_RV_H
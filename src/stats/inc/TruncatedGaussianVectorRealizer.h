@@ -0,0 +1,146 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// QUESO - a library to support the Quantification of Uncertainty
+// for Estimation, Simulation and Optimization
+//
+// Copyright (C) 2008,2009,2010,2011,2012,2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef UQ_TRUNCATED_GAUSSIAN_REALIZER_H
+#define UQ_TRUNCATED_GAUSSIAN_REALIZER_H
+
+#include <queso/VectorRealizer.h>
+#include <queso/VectorSequence.h>
+#include <queso/Environment.h>
+#include <queso/BoxSubset.h>
+#include <math.h>
+
+namespace QUESO {
+
+//! Draws a standard normal variate truncated to [\c alpha, \c beta], by inverting its CDF at the uniform variate \c u.
+/*! Intervals whose tail probability underflows fall back to exponential rejection sampling
+ * (Robert, 1995) with draws from \c rngObject, whose acceptance rate tends to one in the tail.*/
+double TruncatedStdGaussianSample(const RngBase& rngObject, double alpha, double beta, double u);
+
+//*****************************************************
+// Truncated Gaussian class [R-12]
+//*****************************************************
+/*! 
+ * \class TruncatedGaussianVectorRealizer
+ * \brief A class for handling sampling from Gaussian probability density distributions truncated to a box.
+ *
+ * This class handles sampling from a Gaussian probability density distribution restricted to its
+ * image set, which must be a BoxSubset. Realizations are exact and independent:
+ * - with a diagonal covariance matrix, each component is drawn independently by inverting the one
+ *   dimensional truncated normal CDF. No draw is ever rejected, so the cost of a realization does
+ *   not grow when the mean gets close to, or beyond, the boundary of the box;
+ * - with a full covariance matrix, Gaussian draws are rejected until one falls inside the box. The
+ *   expected number of draws is the inverse of the Gaussian probability of the box. After
+ *   setRejectionCap() draws (default: 100) without success, the realization is instead taken
+ *   from a few Gibbs sweeps, see below, started at the point of the box closest to the mean. It
+ *   is then only approximately distributed as the truncated Gaussian, but its cost is bounded.
+ *
+ * With a full covariance matrix, setNumGibbsSweeps() switches to a rejection free Gibbs sampler
+ * instead: each realization then runs that many sweeps over the components, each component being
+ * drawn from its truncated normal conditional. The sampler is a Markov chain whose state is kept
+ * in the object between calls, so successive realizations are correlated and only distributed as
+ * the truncated Gaussian in the limit. Updating the mean or the covariance matrix, or calling
+ * resetGibbsState(), restarts the chain at the point of the box closest to the mean.*/
+
+template<class V, class M>
+class TruncatedGaussianVectorRealizer : public BaseVectorRealizer<V,M> {
+public:
+  
+  //! @name Constructor/Destructor methods
+  //@{
+  //! Constructor
+  /*! Constructs a new object, given a prefix and the box image set of the vector realizer, a
+   * vector of mean values, \c lawExpVector, and a vector of variances, \c lawVarVector (an
+   * alternative representation for a diagonal covariance matrix).  */ 
+  TruncatedGaussianVectorRealizer(const char*                  prefix,
+                                  const VectorSet<V,M>&        unifiedImageSet,
+                                  const V&                     lawExpVector,
+                                  const V&                     lawVarVector);
+
+  //! Constructor
+  /*! Constructs a new object, given a prefix and the box image set of the vector realizer, a
+   * vector of mean values, \c lawExpVector, and a covariance matrix, \c lawCovMatrix.  */ 
+  TruncatedGaussianVectorRealizer(const char*                  prefix,
+                                  const VectorSet<V,M>&        unifiedImageSet,
+                                  const V&                     lawExpVector,
+                                  const M&                     lawCovMatrix);
+  //! Destructor
+  ~TruncatedGaussianVectorRealizer();
+  //@}
+
+  //! @name Realization-related methods
+  //@{
+  //! Access to the vector of mean values and private attribute:  m_unifiedLawExpVector. 
+  const V&   unifiedLawExpVector        ()              const;
+     
+  //! Draws a realization.
+  /*! This function draws a realization of the truncated Gaussian distribution and saves it in
+   * \c nextValues. Only the Gibbs sampler, when enabled, changes the state of the object.*/
+  void realization                (V& nextValues) const;
+  
+  //! Updates the mean with the new value \c newLawExpVector.  
+  void updateLawExpVector         (const V& newLawExpVector);
+  
+  //! Updates the covariance matrix to the new value \c newLawCovMatrix.
+  /*! Only valid for objects constructed with a full covariance matrix.*/
+  void updateLawCovMatrix         (const M& newLawCovMatrix);
+
+  //! Sets the number of Gibbs sweeps per realization (full covariance matrix only).
+  /*! The default, zero, draws exact and independent realizations by rejection. A positive value
+   * switches to the stateful Gibbs sampler described in the class documentation.*/
+  void setNumGibbsSweeps          (unsigned int numGibbsSweeps);
+
+  //! Restarts the Gibbs sampler at the point of the box closest to the mean.
+  void resetGibbsState            ();
+
+  //! Sets the maximum number of rejected draws per realization, and the number of Gibbs sweeps used after them (full covariance matrix only). Defaults: 100 and 10.
+  void setRejectionCap            (unsigned int maxNumDraws, unsigned int numFallbackGibbsSweeps);
+  //@}
+  
+private:
+  //! Runs \c numSweeps Gibbs sweeps over the components of \c state.
+  void gibbsSweeps                (V& state, unsigned int numSweeps) const;
+
+
+  V* m_unifiedLawExpVector;
+  V* m_minValues;
+  V* m_maxValues;
+  V* m_lawStdDevVector;       // Diagonal covariance matrix, else NULL
+  M* m_lowerCholLawCovMatrix; // Full covariance matrix, else NULL
+  M* m_lawPrecMatrix;         // Full covariance matrix, else NULL
+  V* m_condStdDevVector;      // Full covariance matrix: standard deviations of the conditionals, else NULL
+  mutable V* m_gibbsState;    // Gibbs sampler only, else NULL
+  unsigned int m_numGibbsSweeps;
+  unsigned int m_maxNumDraws;
+  unsigned int m_numFallbackGibbsSweeps;
+
+  using BaseVectorRealizer<V,M>::m_env;
+  using BaseVectorRealizer<V,M>::m_prefix;
+  using BaseVectorRealizer<V,M>::m_unifiedImageSet;
+  using BaseVectorRealizer<V,M>::m_subPeriod;
+};
+
+}  // End namespace QUESO
+
+#endif // UQ_TRUNCATED_GAUSSIAN_REALIZER_H
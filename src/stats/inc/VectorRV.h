@@ -28,6 +28,7 @@
 #include <queso/VectorSpace.h>
 #include <queso/JointPdf.h>
 #include <queso/GaussianJointPdf.h>
+#include <queso/TruncatedGaussianJointPdf.h>
 #include <queso/BetaJointPdf.h>
 #include <queso/GammaJointPdf.h>
 #include <queso/UniformJointPdf.h>
@@ -37,6 +38,7 @@
 #include <queso/ConcatenatedJointPdf.h>
 #include <queso/VectorRealizer.h>
 #include <queso/GaussianVectorRealizer.h>
+#include <queso/TruncatedGaussianVectorRealizer.h>
 #include <queso/UniformVectorRealizer.h>
 #include <queso/BetaVectorRealizer.h>
 #include <queso/GammaVectorRealizer.h>
@@ -0,0 +1,15 @@
+#!/bin/bash
+#----------------------------------------------------------
+# Runs test_BlockCyclicMatrix on 3 processes, so that the
+# rows of the matrices are really distributed.
+#----------------------------------------------------------
+
+MPIEXEC=${MPIEXEC:-mpiexec}
+
+# Automake convention: 77 means the test was skipped
+if ! command -v $MPIEXEC > /dev/null 2>&1; then
+    echo "$MPIEXEC not found, skipping"
+    exit 77
+fi
+
+exec $MPIEXEC -np 3 ./test_BlockCyclicMatrix